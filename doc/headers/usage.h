@@ -75,6 +75,7 @@
  * DEBUG_OUTPUT                 - enable debug output (defaults to OFF)
  * DENORMALS_ARE_ZERO           - disable floating point denormals (defaults to ON)
  * FORCE_DEAL_II_SPARSE_MATRIX  - always use deal.II sparse matrix for preliminary assembly instead of Trilinos
+ * PRECOMPUTE_INDICATOR_FLUX    - precompute inverse density and pressure per node for the Euler indicator (defaults to OFF)
  * WITH_ASYNC_MPI_EXCHANGE      - enable asynchronous "communication hiding" MPI exchange (defaults to OFF)
  * WITH_CUSTOM_POW              - use a custom SIMD implementation also for serial pow (default to ON)
  * WITH_DOXYGEN                 - enable support for doxygen and build documentation
@@ -1,6 +1,6 @@
 //
 // SPDX-License-Identifier: MIT
-// Copyright (C) 2020 - 2022 by the ryujin authors
+// Copyright (C) 2020 - 2023 by the ryujin authors
 //
 
 #pragma once
@@ -15,9 +15,13 @@
 #include <boost/archive/binary_oarchive.hpp>
 #include <boost/core/demangle.hpp>
 
+#include <cstdint>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
+#include <limits>
 #include <string>
+#include <vector>
 
 namespace ryujin
 {
@@ -206,5 +210,473 @@ namespace ryujin
         __builtin_trap();
       }
     }
+
+
+    /**
+     * @name Buddy checkpointing
+     *
+     * In addition to the (collective) checkpoints written to a shared
+     * filesystem by write_checkpoint(), every rank can keep a "buddy"
+     * checkpoint in a node-local directory: The rank serializes its
+     * locally owned part of the state vector together with some metadata
+     * into a file, and sends the same data to a partner rank which stores
+     * it as well. The partner is chosen on a different node (assuming a
+     * block-wise placement of ranks onto nodes), so that the data of a
+     * failed node can be recovered from its buddies.
+     *
+     * A buddy checkpoint can only be restored with the same number of MPI
+     * ranks and the same parameter file: The p4est forest and partition
+     * are not stored (p4est only supports collective writes to a single
+     * file). Instead, the mesh is recreated and globally refined as in
+     * the original run. All refinement in ryujin is global and the
+     * (optionally weighted) partitioning is deterministic, so this
+     * reproduces the forest and the partition. A randomly distorted mesh
+     * cannot be reproduced, which is why TimeLoop refuses to enable buddy
+     * checkpointing together with mesh distortion. The partition and the
+     * vertex positions of all locally owned cells are validated when the
+     * state vector is loaded.
+     */
+    //@{
+
+    /**
+     * Metadata stored at the beginning of every buddy checkpoint.
+     *
+     * @ingroup Miscellaneous
+     */
+    struct BuddyCheckpointHeader {
+      static constexpr std::uint64_t magic_number = 0x7279756a696e4231ull;
+
+      std::uint64_t magic = magic_number;
+      std::uint64_t n_ranks = 0;
+      std::uint64_t rank = 0;
+      std::uint64_t n_dofs = 0;
+      std::uint64_t n_owned = 0;
+      std::uint64_t partition_hash = 0;
+      std::uint64_t mesh_hash = 0;
+      std::uint64_t n_comp = 0;
+      std::uint64_t number_size = 0;
+      std::uint64_t n_refinements = 0;
+      std::uint64_t output_cycle = 0;
+      double t = 0.;
+    };
+
+
+    namespace
+    {
+      /**
+       * Return the rank offset between a rank and its buddy. If the job
+       * spans more than one node the buddy is placed one node further.
+       */
+      inline unsigned int buddy_offset(const MPI_Comm &mpi_communicator)
+      {
+        const unsigned int n_ranks =
+            dealii::Utilities::MPI::n_mpi_processes(mpi_communicator);
+
+        int n_ranks_on_node = 1;
+        MPI_Comm node_communicator;
+        int ierr = MPI_Comm_split_type(mpi_communicator,
+                                       MPI_COMM_TYPE_SHARED,
+                                       0,
+                                       MPI_INFO_NULL,
+                                       &node_communicator);
+        AssertThrowMPI(ierr);
+        ierr = MPI_Comm_size(node_communicator, &n_ranks_on_node);
+        AssertThrowMPI(ierr);
+        ierr = MPI_Comm_free(&node_communicator);
+        AssertThrowMPI(ierr);
+
+        if (unsigned(n_ranks_on_node) < n_ranks)
+          return n_ranks_on_node;
+        return n_ranks > 1 ? 1 : 0;
+      }
+
+
+      inline std::string buddy_file_name(const std::string &directory,
+                                         const std::string &base_name,
+                                         const unsigned int rank,
+                                         const std::string &suffix)
+      {
+        const auto name = std::filesystem::path(base_name).filename().string();
+        return (std::filesystem::path(directory) /
+                (name + "-buddy-" + std::to_string(rank) + suffix))
+            .string();
+      }
+
+
+      inline void write_buffer(const std::string &file_name,
+                               const std::vector<char> &buffer)
+      {
+        /* Write to a temporary file first so that we never end up with a
+         * partially written checkpoint: */
+        {
+          std::ofstream file(file_name + "~",
+                             std::ios::binary | std::ios::trunc);
+          file.write(buffer.data(), buffer.size());
+          AssertThrow(file.good(),
+                      dealii::ExcMessage("Could not write buddy checkpoint " +
+                                         file_name));
+        }
+        std::filesystem::rename(file_name + "~", file_name);
+      }
+
+
+      inline bool read_buffer(const std::string &file_name,
+                              std::vector<char> &buffer)
+      {
+        std::ifstream file(file_name, std::ios::binary | std::ios::ate);
+        if (!file.good())
+          return false;
+        buffer.resize(file.tellg());
+        file.seekg(0);
+        file.read(buffer.data(), buffer.size());
+        return file.good();
+      }
+
+
+      /**
+       * Return a hash of the global indices of all locally owned degrees
+       * of freedom (in local numbering).
+       */
+      template <int dim, typename Number>
+      std::uint64_t
+      partition_hash(const OfflineData<dim, Number> &offline_data)
+      {
+        const auto &partitioner = offline_data.scalar_partitioner();
+        std::uint64_t hash = 0xcbf29ce484222325ull; /* FNV-1a */
+        for (unsigned int i = 0; i < offline_data.n_locally_owned(); ++i) {
+          hash ^= partitioner->local_to_global(i);
+          hash *= 0x100000001b3ull;
+        }
+        return hash;
+      }
+
+
+      /**
+       * Return a hash of the cell ids and vertex positions of all locally
+       * owned cells.
+       */
+      template <int dim, typename Number>
+      std::uint64_t mesh_hash(const OfflineData<dim, Number> &offline_data)
+      {
+        std::uint64_t hash = 0xcbf29ce484222325ull; /* FNV-1a */
+        const auto add = [&](const void *data, const std::size_t size) {
+          const auto bytes = static_cast<const unsigned char *>(data);
+          for (std::size_t k = 0; k < size; ++k) {
+            hash ^= bytes[k];
+            hash *= 0x100000001b3ull;
+          }
+        };
+
+        for (const auto &cell :
+             offline_data.dof_handler().active_cell_iterators()) {
+          if (!cell->is_locally_owned())
+            continue;
+          const auto id = cell->id().to_string();
+          add(id.data(), id.size());
+          for (const auto v : cell->vertex_indices()) {
+            const auto vertex = cell->vertex(v);
+            for (unsigned int d = 0; d < dim; ++d) {
+              const double x = vertex[d];
+              add(&x, sizeof(x));
+            }
+          }
+        }
+        return hash;
+      }
+    } // namespace
+
+
+    /**
+     * Writes out a buddy checkpoint for the state @p U at time @p t and
+     * output cycle @p output_cycle. The parameter @p n_refinements is the
+     * number of global refinements that have been performed on the
+     * initial mesh. The function stores the data of the current rank in
+     * @p directory and additionally stores the data received from the
+     * rank whose buddy we are.
+     *
+     * @ingroup Miscellaneous
+     */
+    template <int dim, typename Number, int n_comp, int simd_length>
+    void write_buddy_checkpoint(
+        const OfflineData<dim, Number> &offline_data,
+        const std::string &directory,
+        const std::string &base_name,
+        const MultiComponentVector<Number, n_comp, simd_length> &U,
+        const Number t,
+        const unsigned int n_refinements,
+        const unsigned int output_cycle,
+        const MPI_Comm &mpi_communicator)
+    {
+      const unsigned int rank =
+          dealii::Utilities::MPI::this_mpi_process(mpi_communicator);
+      const unsigned int n_ranks =
+          dealii::Utilities::MPI::n_mpi_processes(mpi_communicator);
+      const unsigned int n_owned = offline_data.n_locally_owned();
+
+      /* Serialize: */
+
+      BuddyCheckpointHeader header;
+      header.n_ranks = n_ranks;
+      header.rank = rank;
+      header.n_dofs = offline_data.dof_handler().n_dofs();
+      header.n_owned = n_owned;
+      header.partition_hash = partition_hash(offline_data);
+      header.mesh_hash = mesh_hash(offline_data);
+      header.n_comp = n_comp;
+      header.number_size = sizeof(Number);
+      header.n_refinements = n_refinements;
+      header.output_cycle = output_cycle;
+      header.t = t;
+
+      std::vector<char> buffer(sizeof(header) +
+                               std::size_t(n_owned) * n_comp * sizeof(Number));
+      std::memcpy(buffer.data(), &header, sizeof(header));
+      auto ptr = buffer.data() + sizeof(header);
+      for (unsigned int i = 0; i < n_owned; ++i) {
+        const auto U_i = U.get_tensor(i);
+        for (unsigned int k = 0; k < n_comp; ++k, ptr += sizeof(Number))
+          std::memcpy(ptr, &U_i[k], sizeof(Number));
+      }
+
+      std::filesystem::create_directories(directory);
+      write_buffer(buddy_file_name(directory, base_name, rank, ".own"),
+                   buffer);
+
+      /* Exchange with buddies: */
+
+      AssertThrow(buffer.size() <= std::numeric_limits<int>::max(),
+                  dealii::ExcMessage("Buddy checkpoint too large"));
+
+      const unsigned int offset = buddy_offset(mpi_communicator);
+      const unsigned int partner = (rank + offset) % n_ranks;
+      const unsigned int source = (rank + n_ranks - offset) % n_ranks;
+      constexpr int tag = 0x6275;
+
+      std::uint64_t size = buffer.size();
+      std::uint64_t received_size = 0;
+      std::vector<char> received;
+
+      MPI_Request request;
+      int ierr = MPI_Isend(
+          &size, 1, MPI_UINT64_T, partner, tag, mpi_communicator, &request);
+      AssertThrowMPI(ierr);
+      ierr = MPI_Recv(&received_size,
+                      1,
+                      MPI_UINT64_T,
+                      source,
+                      tag,
+                      mpi_communicator,
+                      MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+      ierr = MPI_Wait(&request, MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+
+      received.resize(received_size);
+      ierr = MPI_Sendrecv(buffer.data(),
+                          buffer.size(),
+                          MPI_BYTE,
+                          partner,
+                          tag + 1,
+                          received.data(),
+                          received.size(),
+                          MPI_BYTE,
+                          source,
+                          tag + 1,
+                          mpi_communicator,
+                          MPI_STATUS_IGNORE);
+      AssertThrowMPI(ierr);
+
+      write_buffer(buddy_file_name(directory, base_name, source, ".copy"),
+                   received);
+
+      ierr = MPI_Barrier(mpi_communicator);
+      AssertThrowMPI(ierr);
+    }
+
+
+    /**
+     * Return the metadata stored in a buddy checkpoint @p buffer obtained
+     * with read_buddy_checkpoint().
+     *
+     * @ingroup Miscellaneous
+     */
+    inline BuddyCheckpointHeader
+    buddy_checkpoint_header(const std::vector<char> &buffer)
+    {
+      Assert(buffer.size() >= sizeof(BuddyCheckpointHeader),
+             dealii::ExcInternalError());
+      BuddyCheckpointHeader header;
+      std::memcpy(&header, buffer.data(), sizeof(header));
+      return header;
+    }
+
+
+    /**
+     * Read in the buddy checkpoint of the current rank into @p buffer.
+     * Every rank first tries to read its own copy. Ranks for which this
+     * fails receive the copy stored by their buddy. The function returns
+     * true on all ranks if every rank has obtained a valid buffer and all
+     * buffers belong to the same snapshot (identical time, output cycle
+     * and number of refinements), and false otherwise.
+     *
+     * The function has to be called collectively.
+     *
+     * @ingroup Miscellaneous
+     */
+    inline bool read_buddy_checkpoint(const std::string &directory,
+                                      const std::string &base_name,
+                                      std::vector<char> &buffer,
+                                      const MPI_Comm &mpi_communicator)
+    {
+      const unsigned int rank =
+          dealii::Utilities::MPI::this_mpi_process(mpi_communicator);
+      const unsigned int n_ranks =
+          dealii::Utilities::MPI::n_mpi_processes(mpi_communicator);
+
+      const auto valid = [&](const std::vector<char> &data) {
+        if (data.size() < sizeof(BuddyCheckpointHeader))
+          return false;
+        BuddyCheckpointHeader header;
+        std::memcpy(&header, data.data(), sizeof(header));
+        return header.magic == BuddyCheckpointHeader::magic_number &&
+               header.n_ranks == n_ranks && header.rank == rank;
+      };
+
+      bool own_ok =
+          read_buffer(buddy_file_name(directory, base_name, rank, ".own"),
+                      buffer) &&
+          valid(buffer);
+
+      const auto status = dealii::Utilities::MPI::all_gather(
+          mpi_communicator, static_cast<unsigned int>(own_ok));
+
+      const unsigned int offset = buddy_offset(mpi_communicator);
+      const unsigned int partner = (rank + offset) % n_ranks;
+      const unsigned int source = (rank + n_ranks - offset) % n_ranks;
+      constexpr int tag = 0x6276;
+
+      /* Send the copy we hold to the source rank if it lost its data: */
+
+      std::vector<char> copy;
+      std::uint64_t copy_size = 0;
+      std::vector<MPI_Request> requests;
+      if (status[source] == 0) {
+        if (read_buffer(
+                buddy_file_name(directory, base_name, source, ".copy"), copy))
+          copy_size = copy.size();
+        requests.resize(2);
+        int ierr = MPI_Isend(&copy_size,
+                             1,
+                             MPI_UINT64_T,
+                             source,
+                             tag,
+                             mpi_communicator,
+                             &requests[0]);
+        AssertThrowMPI(ierr);
+        ierr = MPI_Isend(copy.data(),
+                         copy.size(),
+                         MPI_BYTE,
+                         source,
+                         tag + 1,
+                         mpi_communicator,
+                         &requests[1]);
+        AssertThrowMPI(ierr);
+      }
+
+      if (!own_ok) {
+        std::uint64_t size = 0;
+        int ierr = MPI_Recv(&size,
+                            1,
+                            MPI_UINT64_T,
+                            partner,
+                            tag,
+                            mpi_communicator,
+                            MPI_STATUS_IGNORE);
+        AssertThrowMPI(ierr);
+        buffer.resize(size);
+        ierr = MPI_Recv(buffer.data(),
+                        buffer.size(),
+                        MPI_BYTE,
+                        partner,
+                        tag + 1,
+                        mpi_communicator,
+                        MPI_STATUS_IGNORE);
+        AssertThrowMPI(ierr);
+        own_ok = valid(buffer);
+      }
+
+      if (!requests.empty()) {
+        const int ierr = MPI_Waitall(
+            requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+        AssertThrowMPI(ierr);
+      }
+
+      if (!dealii::Utilities::MPI::logical_and(own_ok, mpi_communicator))
+        return false;
+
+      /*
+       * Buddy checkpoints are written rank by rank. If a job got killed
+       * while writing, or if a stale copy was recovered from a buddy, the
+       * ranks might hold different snapshots. Make sure that all ranks
+       * resume from the same one:
+       */
+
+      const auto header = buddy_checkpoint_header(buffer);
+      const auto consistent = [&](const double value) {
+        const auto stats =
+            dealii::Utilities::MPI::min_max_avg(value, mpi_communicator);
+        return stats.min == stats.max;
+      };
+
+      return consistent(header.t) &&
+             consistent(static_cast<double>(header.output_cycle)) &&
+             consistent(static_cast<double>(header.n_refinements));
+    }
+
+
+    /**
+     * Restore the state vector @p U from a buddy checkpoint @p buffer
+     * obtained with read_buddy_checkpoint(). The function verifies that
+     * the mesh partition and the vertex positions coincide with the ones
+     * the checkpoint was written with. If this is not the case on at
+     * least one rank, @p U is left untouched and false is returned, so
+     * that the caller can fall back to a regular checkpoint.
+     *
+     * @ingroup Miscellaneous
+     */
+    template <int dim, typename Number, int n_comp, int simd_length>
+    bool load_buddy_state_vector(
+        const OfflineData<dim, Number> &offline_data,
+        const std::vector<char> &buffer,
+        MultiComponentVector<Number, n_comp, simd_length> &U,
+        const MPI_Comm &mpi_communicator)
+    {
+      const auto header = buddy_checkpoint_header(buffer);
+      const unsigned int n_owned = offline_data.n_locally_owned();
+
+      const bool consistent =
+          header.n_dofs == offline_data.dof_handler().n_dofs() &&
+          header.n_owned == n_owned &&
+          header.partition_hash == partition_hash(offline_data) &&
+          header.mesh_hash == mesh_hash(offline_data) &&
+          header.n_comp == n_comp && header.number_size == sizeof(Number) &&
+          buffer.size() == sizeof(header) + std::size_t(n_owned) * n_comp *
+                                                sizeof(Number);
+
+      if (!dealii::Utilities::MPI::logical_and(consistent, mpi_communicator))
+        return false;
+
+      auto ptr = buffer.data() + sizeof(header);
+      for (unsigned int i = 0; i < n_owned; ++i) {
+        dealii::Tensor<1, n_comp, Number> U_i;
+        for (unsigned int k = 0; k < n_comp; ++k, ptr += sizeof(Number))
+          std::memcpy(&U_i[k], ptr, sizeof(Number));
+        U.write_tensor(U_i, i);
+      }
+      U.update_ghost_values();
+      return true;
+    }
+
+    //@}
   } // namespace Checkpointing
 } // namespace ryujin
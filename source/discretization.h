@@ -250,6 +250,12 @@ namespace ryujin
      */
     ACCESSOR_READ_ONLY(quadrature_1d)
 
+    /**
+     * Return the relative amount of random mesh distortion applied in
+     * prepare(). A distorted mesh cannot be recreated identically.
+     */
+    ACCESSOR_READ_ONLY(mesh_distortion)
+
   private:
     //@}
     /**
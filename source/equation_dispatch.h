@@ -17,6 +17,8 @@
 #include <deal.II/base/mpi.h>
 
 #include <filesystem>
+#include <string>
+#include <vector>
 
 namespace ryujin
 {
@@ -73,38 +75,69 @@ namespace ryujin
     void run(const std::string &parameter_file,
              const MPI_Comm &mpi_communicator)
     {
-      std::string name =
-          dealii::Patterns::Tools::Convert<Equation>::to_string(equation_);
+      run(std::vector<std::string>{parameter_file}, mpi_communicator);
+    }
+
+    /**
+     * Batch mode: Run all given parameter files in sequence with a single
+     * TimeLoop object. All parameter files have to select the same
+     * equation.
+     *
+     * Parameter files are parsed on top of each other, i.e., entries that
+     * are not present in a later parameter file retain the value of the
+     * previous case. A parameter study can thus be specified by one full
+     * parameter file followed by short files containing only the entries
+     * that change (such as the initial state, the CFL number, and the
+     * basename). The mesh and the offline data are reused for all
+     * consecutive cases that share the discretization and offline data
+     * subsections, see TimeLoop::run().
+     */
+    void run(const std::vector<std::string> &parameter_files,
+             const MPI_Comm &mpi_communicator)
+    {
+      AssertThrow(!parameter_files.empty(), dealii::ExcInternalError());
 
-      ParameterAcceptor::prm.parse_input(parameter_file,
+      ParameterAcceptor::prm.parse_input(parameter_files.front(),
                                          "",
                                          /* skip undefined */ true,
                                          /* assert entries present */ false);
 
-      name = dealii::Patterns::Tools::Convert<Equation>::to_string(equation_);
-
       switch (equation_) {
-      case Equation::euler: {
-        TimeLoop<Euler::Description, DIM, NUMBER> time_loop(mpi_communicator);
-        ParameterAcceptor::initialize(parameter_file);
-        time_loop.run();
-      }; break;
-      case Equation::euler_aeos: {
-        TimeLoop<EulerAEOS::Description, DIM, NUMBER> time_loop(
-            mpi_communicator);
-        ParameterAcceptor::initialize(parameter_file);
-        time_loop.run();
-      }; break;
-      case Equation::navier_stokes: {
-        TimeLoop<NavierStokes::Description, DIM, NUMBER> time_loop(
-            mpi_communicator);
+      case Equation::euler:
+        run_batch<Euler::Description>(parameter_files, mpi_communicator);
+        break;
+      case Equation::euler_aeos:
+        run_batch<EulerAEOS::Description>(parameter_files, mpi_communicator);
+        break;
+      case Equation::navier_stokes:
+        run_batch<NavierStokes::Description>(parameter_files,
+                                             mpi_communicator);
+        break;
+      }
+    }
+
+  private:
+    template <typename Description>
+    void run_batch(const std::vector<std::string> &parameter_files,
+                   const MPI_Comm &mpi_communicator)
+    {
+      const auto equation = equation_;
+
+      TimeLoop<Description, DIM, NUMBER> time_loop(mpi_communicator);
+
+      for (const auto &parameter_file : parameter_files) {
         ParameterAcceptor::initialize(parameter_file);
+
+        AssertThrow(equation_ == equation,
+                    dealii::ExcMessage(
+                        "All parameter files of a batch run have to select "
+                        "the same equation. The parameter file »" +
+                        parameter_file + "« selects a different one."));
+
         time_loop.run();
-      }; break;
       }
     }
 
-  private:
     Equation equation_;
   };
 
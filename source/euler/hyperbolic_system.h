@@ -55,6 +55,7 @@ namespace ryujin
       double gamma_;
       double reference_density_;
       double vacuum_state_relaxation_;
+      bool linearized_entropy_relaxation_;
 
       double gamma_inverse_;
       double gamma_minus_one_inverse_;
@@ -127,6 +128,11 @@ namespace ryujin
           return ScalarNumber(hyperbolic_system_.vacuum_state_relaxation_);
         }
 
+        DEAL_II_ALWAYS_INLINE inline bool linearized_entropy_relaxation() const
+        {
+          return hyperbolic_system_.linearized_entropy_relaxation_;
+        }
+
         //@}
         /**
          * @name Access to cached inverses
@@ -267,10 +273,24 @@ namespace ryujin
         static inline const auto precomputed_initial_names =
             std::array<std::string, n_precomputed_initial_values>{};
 
+        /**
+         * If set to true the inverse density and the pressure of every
+         * node are stored as additional precomputed values. The Indicator
+         * then assembles the flux f(U_j) of a neighboring node without a
+         * division and a pressure evaluation per edge. Selected with the
+         * compile-time option PRECOMPUTE_INDICATOR_FLUX.
+         */
+#ifdef PRECOMPUTE_INDICATOR_FLUX
+        static constexpr bool precompute_indicator_flux = true;
+#else
+        static constexpr bool precompute_indicator_flux = false;
+#endif
+
         /**
          * The number of precomputed values.
          */
-        static constexpr unsigned int n_precomputed_values = 2;
+        static constexpr unsigned int n_precomputed_values =
+            precompute_indicator_flux ? 4 : 2;
 
         /**
          * Array type used for precomputed values.
@@ -286,8 +306,14 @@ namespace ryujin
         /**
          * An array holding all component names of the precomputed values.
          */
-        static inline const auto precomputed_names =
-            std::array<std::string, n_precomputed_values>{"s", "eta_h"};
+        static inline const auto precomputed_names = []() {
+          std::array<std::string, n_precomputed_values> names{"s", "eta_h"};
+          if constexpr (precompute_indicator_flux) {
+            names[2] = "rho_inverse";
+            names[3] = "p";
+          }
+          return names;
+        }();
 
         /**
          * The number of precomputation cycles.
@@ -296,7 +322,9 @@ namespace ryujin
 
         /**
          * Step 0: precompute values for hyperbolic update. This routine is
-         * called within our usual loop() idiom in HyperbolicModule
+         * called within our usual loop() idiom in HyperbolicModule. The
+         * caller synchronizes all threads after the loop, so the final
+         * work-sharing loop may be issued with RYUJIN_OMP_FOR_NOWAIT.
          */
         template <typename DISPATCH, typename SPARSITY>
         void precomputation_loop(unsigned int cycle,
@@ -491,6 +519,15 @@ namespace ryujin
          */
         flux_type f(const state_type &U) const;
 
+        /**
+         * Variant of above function that takes the inverse density
+         * @p rho_inverse and the pressure @p p of the state @p U as
+         * additional arguments.
+         */
+        flux_type f(const state_type &U,
+                    const Number &rho_inverse,
+                    const Number &p) const;
+
         /**
          * Given a state @p U_i and an index @p i compute flux contributions.
          *
@@ -679,6 +716,17 @@ namespace ryujin
                     vacuum_state_relaxation_,
                     "Problem specific vacuum relaxation parameter");
 
+      linearized_entropy_relaxation_ = false;
+      add_parameter("linearized entropy relaxation",
+                    linearized_entropy_relaxation_,
+                    "Use a lower bound on the specific entropy of the "
+                    "averaged state (U_i + U_j) / 2 computed from the "
+                    "precomputed specific entropies and the density ratio "
+                    "for the relaxation of the entropy bound. This avoids a "
+                    "pow() evaluation per edge and yields bounds that are "
+                    "never weaker than the ones obtained with the exact "
+                    "specific entropy of the averaged state");
+
       /*
        * Precompute a number of derived gamma coefficients that contain
        * divisions:
@@ -713,7 +761,7 @@ namespace ryujin
 
       unsigned int stride_size = get_stride_size<Number>;
 
-      RYUJIN_OMP_FOR
+      RYUJIN_OMP_FOR_NOWAIT
       for (unsigned int i = left; i < right; i += stride_size) {
 
         /* Skip constrained degrees of freedom: */
@@ -724,8 +772,13 @@ namespace ryujin
         dispatch_check(i);
 
         const auto U_i = U.template get_tensor<Number>(i);
-        const precomputed_state_type prec_i{specific_entropy(U_i),
-                                            harten_entropy(U_i)};
+        precomputed_state_type prec_i;
+        prec_i[0] = specific_entropy(U_i);
+        prec_i[1] = harten_entropy(U_i);
+        if constexpr (precompute_indicator_flux) {
+          prec_i[2] = ScalarNumber(1.) / density(U_i);
+          prec_i[3] = pressure(U_i);
+        }
         precomputed_values.template write_tensor<Number>(prec_i, i);
       }
     }
@@ -1161,9 +1214,17 @@ namespace ryujin
     HyperbolicSystem::View<dim, Number>::f(const state_type &U) const
         -> flux_type
     {
-      const auto rho_inverse = ScalarNumber(1.) / density(U);
+      return f(U, ScalarNumber(1.) / density(U), pressure(U));
+    }
+
+
+    template <int dim, typename Number>
+    DEAL_II_ALWAYS_INLINE inline auto
+    HyperbolicSystem::View<dim, Number>::f(const state_type &U,
+                                           const Number &rho_inverse,
+                                           const Number &p) const -> flux_type
+    {
       const auto m = momentum(U);
-      const auto p = pressure(U);
       const auto E = total_energy(U);
 
       flux_type result;
@@ -186,17 +186,23 @@ namespace ryujin
     {
       /* entropy viscosity commutator: */
 
-      const auto &[new_s_i, new_eta_i] =
+      const auto prec_i =
           precomputed_values
               .template get_tensor<Number, precomputed_state_type>(i);
 
-      const auto rho_i = hyperbolic_system.density(U_i);
-      rho_i_inverse = Number(1.) / rho_i;
-      eta_i = new_eta_i;
+      eta_i = prec_i[1];
+
+      if constexpr (HyperbolicSystemView::precompute_indicator_flux) {
+        rho_i_inverse = prec_i[2];
+        f_i = hyperbolic_system.f(U_i, rho_i_inverse, prec_i[3]);
+      } else {
+        rho_i_inverse = Number(1.) / hyperbolic_system.density(U_i);
+        f_i = hyperbolic_system.f(
+            U_i, rho_i_inverse, hyperbolic_system.pressure(U_i));
+      }
 
       d_eta_i = hyperbolic_system.harten_entropy_derivative(U_i);
       d_eta_i[0] -= eta_i * rho_i_inverse;
-      f_i = hyperbolic_system.f(U_i);
 
       left = 0.;
       right = 0.;
@@ -211,15 +217,27 @@ namespace ryujin
     {
       /* entropy viscosity commutator: */
 
-      const auto &[s_j, eta_j] =
+      const auto prec_j =
           precomputed_values
               .template get_tensor<Number, precomputed_state_type>(js);
+      const auto &eta_j = prec_j[1];
 
-      const auto rho_j = hyperbolic_system.density(U_j);
-      const auto rho_j_inverse = Number(1.) / rho_j;
+      /*
+       * With precomputed flux ingredients we avoid a division and a
+       * pressure evaluation per edge:
+       */
+      Number rho_j_inverse;
+      flux_type f_j;
+      if constexpr (HyperbolicSystemView::precompute_indicator_flux) {
+        rho_j_inverse = prec_j[2];
+        f_j = hyperbolic_system.f(U_j, rho_j_inverse, prec_j[3]);
+      } else {
+        rho_j_inverse = Number(1.) / hyperbolic_system.density(U_j);
+        f_j = hyperbolic_system.f(
+            U_j, rho_j_inverse, hyperbolic_system.pressure(U_j));
+      }
 
       const auto m_j = hyperbolic_system.momentum(U_j);
-      const auto f_j = hyperbolic_system.f(U_j);
 
       left += (eta_j * rho_j_inverse - eta_i * rho_i_inverse) * (m_j * c_ij);
       for (unsigned int k = 0; k < problem_dimension; ++k)
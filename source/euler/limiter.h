@@ -207,6 +207,7 @@ namespace ryujin
 
       Bounds bounds_;
 
+      Number s_i;
       Number rho_relaxation_numerator;
       Number rho_relaxation_denominator;
       Number s_interp_max;
@@ -229,9 +230,8 @@ namespace ryujin
       rho_min = Number(std::numeric_limits<ScalarNumber>::max());
       rho_max = Number(0.);
 
-      const auto &[s_i, eta_i] =
-          precomputed_values
-              .template get_tensor<Number, precomputed_state_type>(i);
+      s_i = precomputed_values
+                .template get_tensor<Number, precomputed_state_type>(i)[0];
 
       s_min = s_i;
 
@@ -266,9 +266,9 @@ namespace ryujin
       rho_min = std::min(rho_min, rho_ij_bar);
       rho_max = std::max(rho_max, rho_ij_bar);
 
-      const auto &[s_j, eta_j] =
+      const auto s_j =
           precomputed_values
-              .template get_tensor<Number, precomputed_state_type>(js);
+              .template get_tensor<Number, precomputed_state_type>(js)[0];
       s_min = std::min(s_min, s_j);
 
       /* Relaxation: */
@@ -276,8 +276,29 @@ namespace ryujin
       rho_relaxation_numerator += beta_ij * (rho_i + rho_j);
       rho_relaxation_denominator += std::abs(beta_ij);
 
-      const Number s_interp =
-          hyperbolic_system.specific_entropy((U_i + U_j) * ScalarNumber(.5));
+      Number s_interp;
+      if (hyperbolic_system.linearized_entropy_relaxation()) {
+        /*
+         * Lower bound on s((U_i + U_j) / 2) = (rho e)(U) rho^-gamma. The
+         * internal energy (rho e)(U) is concave, hence
+         *   s((U_i + U_j) / 2) >= (s_i x_i^gamma + s_j x_j^gamma) / 2,
+         * with x_k = rho_k / rho_bar, and we bound x^gamma from below by
+         * its tangent at x = 1. With delta = x_i - 1 = 1 - x_j this gives
+         *   s((U_i + U_j) / 2) >= (s_i + s_j + gamma delta (s_i - s_j)) / 2.
+         * By quasi-concavity of s we also have s((U_i + U_j) / 2) >=
+         * min(s_i, s_j) and we use the larger of the two lower bounds.
+         * Thus, 2 s_min - s_interp_max is never smaller than with the
+         * exact value, and never larger than s_min.
+         */
+        const auto delta = (rho_i - rho_j) / (rho_i + rho_j);
+        const auto gamma = hyperbolic_system.gamma();
+        s_interp = std::max(
+            std::min(s_i, s_j),
+            ScalarNumber(0.5) * (s_i + s_j + gamma * delta * (s_i - s_j)));
+      } else {
+        s_interp =
+            hyperbolic_system.specific_entropy((U_i + U_j) * ScalarNumber(.5));
+      }
       s_interp_max = std::max(s_interp_max, s_interp);
     }
 
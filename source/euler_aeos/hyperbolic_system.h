@@ -356,7 +356,9 @@ namespace ryujin
 
         /**
          * Step 0: precompute values for hyperbolic update. This routine is
-         * called within our usual loop() idiom in HyperbolicModule
+         * called within our usual loop() idiom in HyperbolicModule. The
+         * caller synchronizes all threads after the loop, so the final
+         * work-sharing loop may be issued with RYUJIN_OMP_FOR_NOWAIT.
          */
         template <typename DISPATCH, typename SPARSITY>
         void precomputation_loop(unsigned int cycle,
@@ -871,7 +873,7 @@ namespace ryujin
            * that a call to the eos is not too expensive. This variant
            * calls into the eos library for every single degree of freedom.
            */
-          RYUJIN_OMP_FOR
+          RYUJIN_OMP_FOR_NOWAIT
           for (unsigned int i = left; i < right; i += stride_size) {
             /* Skip constrained degrees of freedom: */
             const unsigned int row_length = sparsity_simd.row_length(i);
@@ -894,7 +896,7 @@ namespace ryujin
       }   /* cycle == 0 */
 
       if (cycle == 1) {
-        RYUJIN_OMP_FOR
+        RYUJIN_OMP_FOR_NOWAIT
         for (unsigned int i = left; i < right; i += stride_size) {
           using PT = precomputed_state_type;
 
@@ -117,7 +117,6 @@ namespace ryujin
       Number t_l = t_min; // good state
 
       const auto &gamma = std::get<3>(bounds) /* = gamma_min*/;
-      const Number gm1 = gamma - Number(1.);
 
       const auto interpolation_b = hyperbolic_system.eos_interpolation_b();
 
@@ -137,6 +136,12 @@ namespace ryujin
          *
          * (s in turn was defined as s =\varepsilon \rho ^{-\gamma}, where
          * \varepsilon = (\rho e) is the internal energy.)
+         *
+         * Both, psi and its derivative, only depend on the single
+         * transcendental term (\rho / (1 - b\rho))^\gamma per point: We
+         * have \rho^\gamma (1 - b\rho)^{-(\gamma - 1)} = (\rho / (1 -
+         * b\rho))^\gamma (1 - b\rho). We thus evaluate exactly one pow()
+         * per point and Newton iteration.
          */
 
         const auto &s_min = std::get<2>(bounds);
@@ -145,13 +150,14 @@ namespace ryujin
 
           const auto U_r = U + t_r * P;
           const auto rho_r = hyperbolic_system.density(U_r);
-          const auto rho_r_gamma = ryujin::pow(rho_r, gamma);
           const auto rho_e_r = hyperbolic_system.internal_energy(U_r);
           const auto covolume_r = Number(1.) - interpolation_b * rho_r;
+          const auto rho_covolume_gamma_r =
+              ryujin::pow(rho_r / covolume_r, gamma);
+          const auto rho_gamma_covolume_r = rho_covolume_gamma_r * covolume_r;
 
-          auto psi_r =
-              relax_small * rho_r * rho_e_r -
-              s_min * rho_r * rho_r_gamma * ryujin::pow(covolume_r, -gm1);
+          auto psi_r = relax_small * rho_r * rho_e_r -
+                       s_min * rho_r * rho_gamma_covolume_r;
 
           /*
            * If psi_r > 0 the right state is fine, force returning t_r by
@@ -176,20 +182,21 @@ namespace ryujin
 
           const auto U_l = U + t_l * P;
           const auto rho_l = hyperbolic_system.density(U_l);
-          const auto rho_l_gamma = ryujin::pow(rho_l, gamma);
           const auto rho_e_l = hyperbolic_system.internal_energy(U_l);
           const auto covolume_l = Number(1.) - interpolation_b * rho_l;
+          const auto rho_covolume_gamma_l =
+              ryujin::pow(rho_l / covolume_l, gamma);
+          const auto rho_gamma_covolume_l = rho_covolume_gamma_l * covolume_l;
 
-          auto psi_l =
-              relax_small * rho_l * rho_e_l -
-              s_min * rho_l * rho_l_gamma * ryujin::pow(covolume_l, -gm1);
+          auto psi_l = relax_small * rho_l * rho_e_l -
+                       s_min * rho_l * rho_gamma_covolume_l;
 
           /*
            * Verify that the left state is within bounds. This property might
            * be violated for relative CFL numbers larger than 1.
            */
           const auto lower_bound = (ScalarNumber(1.) - relax) * s_min * rho_l *
-                                   rho_l_gamma * ryujin::pow(covolume_l, -gm1);
+                                   rho_gamma_covolume_l;
           if (n == 0 &&
               !(std::min(Number(0.), psi_l - lower_bound) == Number(0.))) {
 #ifdef DEBUG_OUTPUT
@@ -217,10 +224,10 @@ namespace ryujin
               hyperbolic_system.internal_energy_derivative(U_r) * P;
 
           const auto extra_term_l =
-              s_min * ryujin::pow(rho_l / covolume_l, gamma) *
+              s_min * rho_covolume_gamma_l *
               (covolume_l + gamma - interpolation_b * rho_l);
           const auto extra_term_r =
-              s_min * ryujin::pow(rho_r / covolume_r, gamma) *
+              s_min * rho_covolume_gamma_r *
               (covolume_r + gamma - interpolation_b * rho_r);
 
           const auto dpsi_l =
@@ -250,16 +257,15 @@ namespace ryujin
 
           const auto rho_new = hyperbolic_system.density(U_new);
           const auto rho_e_new = hyperbolic_system.internal_energy(U_new);
-          const auto rho_gamma_new = ryujin::pow(rho_new, gamma);
           const auto covolume_new = Number(1.) - interpolation_b * rho_new;
+          const auto rho_gamma_covolume_new =
+              ryujin::pow(rho_new / covolume_new, gamma) * covolume_new;
 
-          const auto psi =
-              relax_small * rho_new * rho_e_new -
-              s_min * rho_new * rho_gamma_new * ryujin::pow(covolume_new, -gm1);
+          const auto psi = relax_small * rho_new * rho_e_new -
+                           s_min * rho_new * rho_gamma_covolume_new;
 
           const auto lower_bound = (ScalarNumber(1.) - relax) * s_min *
-                                   rho_new * rho_gamma_new *
-                                   ryujin::pow(covolume_new, -gm1);
+                                   rho_new * rho_gamma_covolume_new;
 
           const bool e_valid = std::min(Number(0.), rho_e_new) == Number(0.);
           const bool psi_valid =
@@ -10,8 +10,12 @@
 #include "convenience_macros.h"
 #include "initial_values.h"
 #include "offline_data.h"
+#include "roofline.h"
+#include "row_block_schedule.h"
 #include "simd.h"
 #include "sparse_matrix_simd.h"
+#include "sparse_matrix_simd_quantized.h"
+#include "write_policy.h"
 
 #include <deal.II/base/parameter_acceptor.h>
 #include <deal.II/base/timer.h>
@@ -19,6 +23,8 @@
 #include <deal.II/lac/vector.h>
 
 #include <functional>
+#include <map>
+#include <string>
 
 namespace ryujin
 {
@@ -161,6 +167,13 @@ namespace ryujin
      */
     void prepare();
 
+    /**
+     * Record the memory consumption (in bytes) of all matrices and
+     * temporary vectors allocated by prepare() in @p statistics.
+     */
+    void
+    memory_statistics(std::map<std::string, std::size_t> &statistics) const;
+
     /**
      * @name Functons for performing explicit time steps
      */
@@ -303,6 +316,34 @@ namespace ryujin
      */
     ACCESSOR_READ_ONLY(n_warnings)
 
+    /**
+     * The estimated memory traffic and floating point operations of all
+     * phases of the step() function accumulated over all invocations
+     * since the last call to reset_traffic(). The map is indexed by the
+     * computing timer section of the phase.
+     */
+    ACCESSOR_READ_ONLY(traffic)
+
+    /**
+     * Reset the accumulated traffic estimates returned by traffic(). This
+     * function should be called whenever the computing timers are reset.
+     */
+    void reset_traffic() const
+    {
+      traffic_.clear();
+    }
+
+    /**
+     * Reset the number of restarts and warnings returned by n_restarts()
+     * and n_warnings(). This function is called at the beginning of every
+     * run of a batch of parameter files.
+     */
+    void reset_statistics() const
+    {
+      n_restarts_ = 0;
+      n_warnings_ = 0;
+    }
+
     // FIXME: refactor to function
     mutable bool precompute_only_;
 
@@ -323,6 +364,15 @@ namespace ryujin
 
     bool cfl_with_boundary_dofs_;
 
+    bool dataflow_scheduling_;
+    unsigned int dataflow_block_size_;
+
+    bool recompute_p_ij_;
+    bool quantize_lij_;
+
+    WritePolicy write_policy_;
+    unsigned int last_level_cache_size_;
+
     //@}
 
     //@}
@@ -361,9 +411,35 @@ namespace ryujin
     mutable SparseMatrixSIMD<Number> dij_matrix_;
     mutable SparseMatrixSIMD<Number> lij_matrix_;
     mutable SparseMatrixSIMD<Number> lij_matrix_next_;
+    mutable QuantizedSparseMatrixSIMD<Number> lij_quantized_;
+    mutable QuantizedSparseMatrixSIMD<Number> lij_quantized_next_;
     mutable SparseMatrixSIMD<Number, problem_dimension> pij_matrix_;
     mutable SparseMatrixSIMD<Number, problem_dimension> qij_matrix_;
 
+    mutable RowBlockSchedule<dealii::VectorizedArray<Number>::size()>
+        row_block_schedule_;
+
+    /* Streaming store decisions made in prepare(), see WritePolicy: */
+    bool streaming_dij_;
+    bool streaming_pij_;
+    bool streaming_pij_update_;
+    bool streaming_lij_;
+    bool streaming_lij_next_;
+    bool streaming_state_;
+    bool streaming_r_;
+    bool streaming_bounds_;
+
+    /* Traffic estimates for a single invocation of each phase: */
+    TrafficEstimate traffic_precompute_;
+    TrafficEstimate traffic_dij_;
+    TrafficEstimate traffic_tau_;
+    TrafficEstimate traffic_low_order_;
+    TrafficEstimate traffic_lij_;
+    TrafficEstimate traffic_high_order_;
+    TrafficEstimate traffic_high_order_last_;
+
+    mutable std::map<std::string, TrafficEstimate> traffic_;
+
     //@}
   };
 
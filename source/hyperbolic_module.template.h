@@ -7,6 +7,7 @@
 
 #include "hyperbolic_module.h"
 #include "introspection.h"
+#include "load_imbalance.h"
 #include "openmp.h"
 #include "scope.h"
 #include "simd.h"
@@ -68,6 +69,59 @@ namespace ryujin
                   cfl_with_boundary_dofs_,
                   "Use also the local wave-speed estimate d_ij of boundary "
                   "dofs when computing the maximal admissible step size");
+
+    dataflow_scheduling_ = false;
+    add_parameter("dataflow scheduling",
+                  dataflow_scheduling_,
+                  "Replace the thread barriers between the low-order update, "
+                  "the computation of l_ij, and the first high-order update "
+                  "by point-to-point dependencies between neighboring row "
+                  "blocks");
+
+    dataflow_block_size_ = 512;
+    add_parameter("dataflow block size",
+                  dataflow_block_size_,
+                  "Number of rows per row block used for dataflow scheduling");
+
+    recompute_p_ij_ = false;
+    add_parameter("recompute p_ij",
+                  recompute_p_ij_,
+                  "Do not store the high-order correction P_ij in a sparse "
+                  "matrix but recompute it on the fly when limiting. This "
+                  "reduces memory footprint and bandwidth at the expense of "
+                  "additional arithmetic");
+
+    quantize_lij_ = false;
+    add_parameter("quantize limiter coefficients",
+                  quantize_lij_,
+                  "Store the limiter coefficients l_ij in a 16-bit fixed-point "
+                  "format instead of full precision. Values are rounded "
+                  "down, which preserves the invariant-domain property and "
+                  "reduces the memory traffic of the limiter passes");
+
+    write_policy_ = WritePolicy::automatic;
+    add_parameter("write policy",
+                  write_policy_,
+                  "Policy for writing large matrices and vectors: automatic, "
+                  "cached, or streaming. The automatic policy uses a static "
+                  "cache model evaluated once in prepare(): an array written "
+                  "in a phase of the time step is assumed to be read again "
+                  "only after all data of that phase has passed through the "
+                  "cache. Streaming stores are used if the estimated memory "
+                  "traffic of the phase exceeds the last level cache size "
+                  "divided by the number of MPI ranks on the node. Other "
+                  "processes, hardware prefetching, and the actual cache "
+                  "replacement policy are not taken into account");
+
+    last_level_cache_size_ = 0;
+    add_parameter("last level cache size",
+                  last_level_cache_size_,
+                  "Size of the last level cache in KiB used by the cache "
+                  "model of the automatic write policy. The cache is assumed "
+                  "to be shared by all MPI ranks of a node, and on multi-"
+                  "socket nodes the size of a single socket's cache should "
+                  "be given. If set to 0 the size is queried from the "
+                  "operating system");
   }
 
 
@@ -102,13 +156,152 @@ namespace ryujin
 
     const auto &sparsity_simd = offline_data_->sparsity_pattern_simd();
     dij_matrix_.reinit(sparsity_simd);
-    lij_matrix_.reinit(sparsity_simd);
-    lij_matrix_next_.reinit(sparsity_simd);
-    pij_matrix_.reinit(sparsity_simd);
+    if (quantize_lij_) {
+      lij_matrix_ = SparseMatrixSIMD<Number>();
+      lij_matrix_next_ = SparseMatrixSIMD<Number>();
+      lij_quantized_.reinit(sparsity_simd);
+      lij_quantized_next_.reinit(sparsity_simd);
+    } else {
+      lij_matrix_.reinit(sparsity_simd);
+      lij_matrix_next_.reinit(sparsity_simd);
+      lij_quantized_ = QuantizedSparseMatrixSIMD<Number>();
+      lij_quantized_next_ = QuantizedSparseMatrixSIMD<Number>();
+    }
+    if (recompute_p_ij_)
+      pij_matrix_ = SparseMatrixSIMD<Number, problem_dimension>();
+    else
+      pij_matrix_.reinit(sparsity_simd);
     if constexpr (View::have_source_terms) {
+      AssertThrow(!recompute_p_ij_,
+                  dealii::ExcMessage("Recomputing P_ij is not supported for "
+                                     "hyperbolic systems with source terms"));
       qij_matrix_.reinit(sparsity_simd);
     }
 
+    /*
+     * Set up row blocks. Without dataflow scheduling we simply use one
+     * SIMD row per block (and one row per block in the non-vectorized
+     * range), which recovers the usual row-wise distribution of work
+     * among threads.
+     */
+
+    constexpr auto simd_length = VectorizedArray<Number>::size();
+    row_block_schedule_.reinit(
+        sparsity_simd,
+        offline_data_->n_export_indices(),
+        offline_data_->n_locally_internal(),
+        offline_data_->n_locally_owned(),
+        dataflow_scheduling_ ? dataflow_block_size_ : simd_length,
+        dataflow_scheduling_);
+
+    /*
+     * Estimate the memory traffic and the number of floating point
+     * operations of every phase of step(). The traffic estimate is the
+     * total amount of data accessed in a phase (source vectors and
+     * additional Runge-Kutta stages are neglected). The flop counts are
+     * coarse per-entry estimates of the dominant arithmetic.
+     */
+
+    constexpr std::size_t n_bytes = sizeof(Number);
+    const double n_nonzero = sparsity_simd.n_nonzero_elements();
+    const double n_relevant = offline_data_->n_locally_relevant();
+    const double matrix = n_nonzero * n_bytes;
+    const double vector = n_relevant * n_bytes;
+    const double lij =
+        quantize_lij_ ? n_nonzero * sizeof(std::uint16_t) : matrix;
+
+    /* U, precomputed values: */
+    traffic_precompute_ = {
+        n_precomputation_cycles * (problem_dimension + n_precomputed_values) *
+            vector,
+        n_precomputation_cycles * 10. * problem_dimension * n_relevant};
+
+    /* c_ij, d_ij, U, precomputed values, alpha: */
+    traffic_dij_ = {
+        (dim + 1) * matrix +
+            (problem_dimension + n_precomputed_values + 1) * vector,
+        n_nonzero * (2. * dim + 25. * problem_dimension) / 2.};
+
+    /* d_ij, m_i, tau_max: */
+    traffic_tau_ = {matrix + 2 * vector, 2. * n_nonzero};
+
+    /*
+     * P_ij (and Q_ij for hyperbolic systems with source terms) are either
+     * stored in Step 3 and read back in Steps 4 - 6, or recomputed on the
+     * fly from c_ij, d_ij, U, precomputed values and alpha. Recomputing
+     * the high-order update additionally needs m_ij and r.
+     */
+    const double pij = (recompute_p_ij_ ? 0. : problem_dimension * matrix) +
+                       (View::have_source_terms ? problem_dimension * matrix
+                                                : 0.);
+    const double recompute =
+        recompute_p_ij_
+            ? (dim + 1) * matrix +
+                  (problem_dimension + n_precomputed_values + 1) * vector
+            : 0.;
+    const double recompute_correction =
+        recompute_p_ij_ ? matrix + problem_dimension * vector : 0.;
+    const double recompute_flops =
+        recompute_p_ij_ ? n_nonzero * (4. * dim + 8.) * problem_dimension
+                        : 0.;
+
+    /* c_ij, d_ij, beta_ij, p_ij, U, new_U, r, bounds, precomputed, alpha: */
+    traffic_low_order_ = {
+        (dim + 2) * matrix + pij +
+            (3 * problem_dimension + n_bounds + n_precomputed_values + 1) *
+                vector,
+        n_nonzero * ((4. * dim + 8.) * problem_dimension + 5. * n_bounds)};
+
+    /* m_ij, p_ij (read and write, or recomputed), l_ij, new_U, r, bounds: */
+    traffic_lij_ = {matrix + 2 * pij + recompute + lij +
+                        (2 * problem_dimension + n_bounds) * vector,
+                    n_nonzero * (2. * problem_dimension + 20. * n_bounds) +
+                        recompute_flops};
+
+    /* l_ij (and transposed), p_ij, next l_ij, new_U, bounds: */
+    traffic_high_order_ = {pij + recompute + recompute_correction + 3 * lij +
+                               (2 * problem_dimension + n_bounds) * vector,
+                           n_nonzero *
+                               (3. * problem_dimension + 20. * n_bounds) +
+                               recompute_flops};
+
+    /* l_ij (and transposed), p_ij, new_U: */
+    traffic_high_order_last_ = {pij + recompute + recompute_correction +
+                                    2 * lij + 2 * problem_dimension * vector,
+                                n_nonzero * 3. * problem_dimension +
+                                    recompute_flops};
+
+    /*
+     * Decide on streaming stores. We estimate the reuse distance of an
+     * entry written in a given phase by the memory traffic of that phase.
+     */
+
+    const std::size_t cache_capacity = cache_capacity_per_rank(
+        mpi_communicator_, std::size_t(last_level_cache_size_) * 1024);
+
+    const auto decide = [&](const TrafficEstimate &traffic) {
+      return use_streaming_store(
+          write_policy_, std::size_t(traffic.bytes), cache_capacity);
+    };
+
+    streaming_dij_ = decide(traffic_dij_);
+    /* Without a stored P_ij (or Q_ij) there is nothing to decide: */
+    const bool store_pij = !recompute_p_ij_ || View::have_source_terms;
+    streaming_pij_ = store_pij && decide(traffic_low_order_);
+    streaming_pij_update_ = store_pij && decide(traffic_lij_);
+    streaming_lij_ = decide(traffic_lij_);
+    streaming_lij_next_ = decide(traffic_high_order_);
+    streaming_state_ = decide(traffic_low_order_);
+    streaming_r_ = decide(traffic_low_order_);
+    streaming_bounds_ = decide(traffic_low_order_);
+
+#ifdef DEBUG_OUTPUT
+    std::cout << "        cache capacity per rank = " << cache_capacity
+              << ", streaming stores (dij, pij, lij, state) = "
+              << streaming_dij_ << streaming_pij_ << streaming_lij_
+              << streaming_state_ << std::endl;
+#endif
+
     precomputed_initial_ =
         initial_values_->interpolate_precomputed_initial_values();
   }
@@ -194,7 +387,11 @@ namespace ryujin
     /* A monotonically increasing "channel" variable for mpi_tags: */
     unsigned int channel = 10;
 
-    /* Lambda for creating the computing timer string: */
+    /*
+     * Create the computing timer strings for all phases upfront. The
+     * timers are started and stopped by the master thread from within the
+     * persistent parallel region below.
+     */
     int step_no = 0;
     const auto scoped_name = [&step_no](const auto &name,
                                         const bool advance = true) {
@@ -202,9 +399,240 @@ namespace ryujin
       return "time step [H] " + std::to_string(step_no++) + " - " + name;
     };
 
+    std::string section_precompute;
+    if constexpr (n_precomputation_cycles != 0)
+      section_precompute = scoped_name("precompute values");
+    const int marker_precompute = step_no;
+
+    const auto section_dij = scoped_name("compute d_ij, and alpha_i");
+    const int marker_dij = step_no;
+
+    const auto section_tau =
+        scoped_name("compute bdry d_ij, diag d_ii, and tau_max");
+    const int marker_tau = step_no;
+
+    const auto section_barrier = scoped_name("synchronization barrier", false);
+
+    const auto section_low_order =
+        scoped_name("l.-o. update, compute bounds, r_i, and p_ij");
+    const int marker_low_order = step_no;
+
+    std::string section_lij;
+    if (limiter_iter_ != 0)
+      section_lij = scoped_name("compute p_ij, and l_ij");
+    const int marker_lij = step_no;
+
+    std::vector<std::string> section_high_order;
+    std::vector<int> marker_high_order;
+    for (unsigned int pass = 0; pass < limiter_iter_; ++pass) {
+      const bool last_round = (pass + 1 == limiter_iter_);
+      std::string additional_step = (last_round ? "" : ", next l_ij");
+      section_high_order.push_back(
+          scoped_name("symmetrize l_ij, h.-o. update" + additional_step));
+      marker_high_order.push_back(step_no);
+    }
+
+    /*
+     * Per-thread busy and wait times for measuring the load imbalance
+     * among threads (null pointers if disabled), see LoadImbalance:
+     */
+
+    LoadImbalance::Data *imbalance_precompute = nullptr;
+    if constexpr (n_precomputation_cycles != 0)
+      imbalance_precompute = load_imbalance().section(section_precompute);
+    const auto imbalance_dij = load_imbalance().section(section_dij);
+    const auto imbalance_tau = load_imbalance().section(section_tau);
+    const auto imbalance_low_order =
+        load_imbalance().section(section_low_order);
+    LoadImbalance::Data *imbalance_lij = nullptr;
+    if (limiter_iter_ != 0)
+      imbalance_lij = load_imbalance().section(section_lij);
+    std::vector<LoadImbalance::Data *> imbalance_high_order;
+    for (const auto &section : section_high_order)
+      imbalance_high_order.push_back(load_imbalance().section(section));
+
+    /* Small helpers to start and stop timers on the master thread: */
+
+    const auto start_timer = [&](const std::string &section) {
+#ifdef DEBUG_OUTPUT
+      std::cout << "{scoped timer} \"" << section << "\" started" << std::endl;
+#endif
+      computing_timer_[section].start();
+      performance_counters().start(section);
+    };
+
+    const auto stop_timer = [&](const std::string &section,
+                                const TrafficEstimate &traffic) {
+#ifdef DEBUG_OUTPUT
+      std::cout << "{scoped timer} \"" << section << "\" stopped" << std::endl;
+#endif
+      performance_counters().stop(section);
+      computing_timer_[section].stop();
+      traffic_[section] += traffic;
+    };
+
+    /*
+     * Synchronization dispatchers for all MPI exchanges. The payloads are
+     * executed (or awaited) by a single thread at the end of each phase.
+     */
+
+    SynchronizationDispatch precomputed_dispatch([&]() {
+      new_precomputed.update_ghost_values_start(channel++);
+      new_precomputed.update_ghost_values_finish();
+    });
+
+    SynchronizationDispatch alpha_dispatch([&]() {
+      alpha_.update_ghost_values_start(channel++);
+      alpha_.update_ghost_values_finish();
+    });
+
+    SynchronizationDispatch r_dispatch([&]() {
+      r_.update_ghost_values_start(channel++);
+      source_.update_ghost_values_start(channel++);
+      source_r_.update_ghost_values_start(channel++);
+      r_.update_ghost_values_finish();
+      source_.update_ghost_values_finish();
+      source_r_.update_ghost_values_finish();
+    });
+
+    SynchronizationDispatch lij_dispatch([&]() {
+      if (quantize_lij_) {
+        lij_quantized_.update_ghost_rows_start(channel++);
+        lij_quantized_.update_ghost_rows_finish();
+      } else {
+        lij_matrix_.update_ghost_rows_start(channel++);
+        lij_matrix_.update_ghost_rows_finish();
+      }
+    });
+
+    /* The current limiter pass, written by a single thread: */
+    unsigned int pass = 0;
+
+    SynchronizationDispatch lij_next_dispatch([&]() {
+      if (pass + 1 != limiter_iter_) {
+        if (quantize_lij_) {
+          lij_quantized_next_.update_ghost_rows_start(channel++);
+          lij_quantized_next_.update_ghost_rows_finish();
+        } else {
+          lij_matrix_next_.update_ghost_rows_start(channel++);
+          lij_matrix_next_.update_ghost_rows_finish();
+        }
+      }
+    });
+
     /* A boolean signalling that a restart is necessary: */
     std::atomic<bool> restart_needed = false;
 
+    /* Epoch numbers for point-to-point synchronization of row blocks: */
+    const auto epoch_base = row_block_schedule_.begin_step(2);
+    const auto epoch_low_order = epoch_base + 1;
+    const auto epoch_lij = epoch_base + 2;
+
+    /* Shared state for the early return after Step 2: */
+    bool crashed = false;
+    bool return_early = false;
+
+    std::atomic<Number> tau_max{std::numeric_limits<Number>::infinity()};
+
+    const Number weight =
+        -std::accumulate(stage_weights.begin(), stage_weights.end(), -1.);
+
+    /*
+     * If P_ij is not stored in pij_matrix_ (recompute_p_ij_ is set) we
+     * recompute it on the fly in Steps 4 - 6 from per node quantities.
+     * The first lambda computes these per node quantities for a given
+     * row i, the second lambda computes the same P_ij as Step 3 (before
+     * the mass matrix correction of Step 4 is applied).
+     */
+
+    const auto recompute_row = [&](const auto &view,
+                                   const unsigned int i,
+                                   auto &U_i,
+                                   auto &flux_i,
+                                   auto &flux_iHs,
+                                   auto &alpha_i) {
+      using T = std::decay_t<decltype(alpha_i)>;
+
+      U_i = old_U.template get_tensor<T>(i);
+      flux_i = view.flux_contribution(
+          new_precomputed, precomputed_initial_, i, U_i);
+      for (int s = 0; s < stages; ++s) {
+        const auto temp = stage_U[s].get().template get_tensor<T>(i);
+        flux_iHs[s] = view.flux_contribution(
+            stage_precomputed[s].get(), precomputed_initial_, i, temp);
+      }
+      alpha_i = load_value<T>(alpha_, i);
+    };
+
+    const auto recompute_p_ij = [&](const auto &view,
+                                    const unsigned int i,
+                                    const unsigned int *js,
+                                    const unsigned int col_idx,
+                                    const auto &U_i,
+                                    const auto &flux_i,
+                                    const auto &flux_iHs,
+                                    const auto &alpha_i) {
+      using T = std::decay_t<decltype(alpha_i)>;
+      using View = std::decay_t<decltype(view)>;
+
+      const auto U_j = old_U.template get_tensor<T>(js);
+      const auto alpha_j = load_value<T>(alpha_, js);
+
+      const auto d_ij = dij_matrix_.template get_entry<T>(i, col_idx);
+      const auto d_ijH = d_ij * (alpha_i + alpha_j) * Number(.5);
+      const auto c_ij = cij_matrix.template get_tensor<T>(i, col_idx);
+
+      const auto flux_j = view.flux_contribution(
+          new_precomputed, precomputed_initial_, js, U_j);
+
+      const auto flux_ij = view.flux(flux_i, flux_j);
+      auto P_ij = -contract(flux_ij, c_ij);
+
+      if constexpr (View::have_equilibrated_states) {
+        const auto &[U_star_ij, U_star_ji] =
+            view.equilibrated_states(flux_i, flux_j);
+        P_ij += (d_ijH - d_ij) * (U_star_ji - U_star_ij);
+      } else {
+        P_ij += (d_ijH - d_ij) * (U_j - U_i);
+      }
+
+      if constexpr (View::have_high_order_flux) {
+        const auto high_order_flux_ij = view.high_order_flux(flux_i, flux_j);
+        P_ij += weight * contract(high_order_flux_ij, c_ij);
+      } else {
+        P_ij += weight * contract(flux_ij, c_ij);
+      }
+
+      for (int s = 0; s < stages; ++s) {
+        const auto U_jH = stage_U[s].get().template get_tensor<T>(js);
+        const auto p = view.flux_contribution(
+            stage_precomputed[s].get(), precomputed_initial_, js, U_jH);
+
+        if constexpr (View::have_high_order_flux) {
+          const auto high_order_flux_ij = view.high_order_flux(flux_iHs[s], p);
+          P_ij += stage_weights[s] * contract(high_order_flux_ij, c_ij);
+        } else {
+          const auto flux_ij = view.flux(flux_iHs[s], p);
+          P_ij += stage_weights[s] * contract(flux_ij, c_ij);
+        }
+      }
+
+      return P_ij;
+    };
+
+    /*
+     * We perform all steps within a single, persistent parallel region.
+     * Individual phases are separated by thread barriers, and all MPI
+     * communication is driven by a single thread inside
+     * RYUJIN_OMP_SINGLE sections.
+     *
+     * With dataflow scheduling enabled the barriers after Step 3 and
+     * Step 4 are replaced by point-to-point dependencies between
+     * neighboring row blocks, see RowBlockSchedule.
+     */
+
+    RYUJIN_PARALLEL_REGION_BEGIN
+
     /*
      * -------------------------------------------------------------------------
      * Step 0: Precompute values
@@ -212,17 +640,15 @@ namespace ryujin
      */
 
     if constexpr (n_precomputation_cycles != 0) {
-      Scope scope(computing_timer_, scoped_name("precompute values"));
+      RYUJIN_OMP_MASTER
+      start_timer(section_precompute);
 
       for (unsigned int cycle = 0; cycle < n_precomputation_cycles; ++cycle) {
 
-        SynchronizationDispatch synchronization_dispatch([&]() {
-          new_precomputed.update_ghost_values_start(channel++);
-          new_precomputed.update_ghost_values_finish();
-        });
+        LoadImbalance::begin(imbalance_precompute);
 
-        RYUJIN_PARALLEL_REGION_BEGIN
-        LIKWID_MARKER_START(("time_step_" + std::to_string(step_no)).c_str());
+        LIKWID_MARKER_START(
+            ("time_step_" + std::to_string(marker_precompute)).c_str());
 
         auto loop = [&](auto sentinel, unsigned int left, unsigned int right) {
           using T = decltype(sentinel);
@@ -234,7 +660,7 @@ namespace ryujin
           view.precomputation_loop(
               cycle,
               [&](const unsigned int i) {
-                synchronization_dispatch.check(
+                precomputed_dispatch.check(
                     thread_ready, i >= n_export_indices && i < n_internal);
               },
               new_precomputed,
@@ -249,9 +675,25 @@ namespace ryujin
         /* Parallel vectorized SIMD loop: */
         loop(VA(), 0, n_internal);
 
-        LIKWID_MARKER_STOP(("time_step_" + std::to_string(step_no)).c_str());
-        RYUJIN_PARALLEL_REGION_END
+        LIKWID_MARKER_STOP(
+            ("time_step_" + std::to_string(marker_precompute)).c_str());
+
+        /*
+         * The work-sharing loops of all phases are issued without an
+         * implicit barrier. The explicit barrier at the end of each phase
+         * is required before the ghost exchange is finalized and is the
+         * only synchronization point that LoadImbalance instruments.
+         */
+        LoadImbalance::arrive(imbalance_precompute);
+        RYUJIN_OMP_BARRIER
+        LoadImbalance::depart(imbalance_precompute);
+
+        RYUJIN_OMP_SINGLE
+        precomputed_dispatch.finalize();
       }
+
+      RYUJIN_OMP_MASTER
+      stop_timer(section_precompute, traffic_precompute_);
     }
 
     /*
@@ -281,15 +723,12 @@ namespace ryujin
      */
 
     {
-      Scope scope(computing_timer_, scoped_name("compute d_ij, and alpha_i"));
+      RYUJIN_OMP_MASTER
+      start_timer(section_dij);
 
-      SynchronizationDispatch synchronization_dispatch([&]() {
-        alpha_.update_ghost_values_start(channel++);
-        alpha_.update_ghost_values_finish();
-      });
+      LoadImbalance::begin(imbalance_dij);
 
-      RYUJIN_PARALLEL_REGION_BEGIN
-      LIKWID_MARKER_START(("time_step_" + std::to_string(step_no)).c_str());
+      LIKWID_MARKER_START(("time_step_" + std::to_string(marker_dij)).c_str());
 
       auto loop = [&](auto sentinel, unsigned int left, unsigned int right) {
         using T = decltype(sentinel);
@@ -302,7 +741,7 @@ namespace ryujin
             *hyperbolic_system_, new_precomputed);
         bool thread_ready = false;
 
-        RYUJIN_OMP_FOR
+        RYUJIN_OMP_FOR_NOWAIT
         for (unsigned int i = left; i < right; i += stride_size) {
 
           /* Skip constrained degrees of freedom: */
@@ -310,8 +749,8 @@ namespace ryujin
           if (row_length == 1)
             continue;
 
-          synchronization_dispatch.check(
-              thread_ready, i >= n_export_indices && i < n_internal);
+          alpha_dispatch.check(thread_ready,
+                               i >= n_export_indices && i < n_internal);
 
           const auto U_i = old_U.template get_tensor<T>(i);
 
@@ -338,7 +777,7 @@ namespace ryujin
                 riemann_solver.compute(U_i, U_j, i, js, n_ij);
             const auto d_ij = norm * lambda_max;
 
-            dij_matrix_.write_entry(d_ij, i, col_idx, true);
+            dij_matrix_.write_entry(d_ij, i, col_idx, streaming_dij_);
           }
 
           const auto mass = load_value<T>(lumped_mass_matrix, i);
@@ -352,8 +791,17 @@ namespace ryujin
       /* Parallel vectorized SIMD loop: */
       loop(VA(), 0, n_internal);
 
-      LIKWID_MARKER_STOP(("time_step_" + std::to_string(step_no)).c_str());
-      RYUJIN_PARALLEL_REGION_END
+      LIKWID_MARKER_STOP(("time_step_" + std::to_string(marker_dij)).c_str());
+
+      LoadImbalance::arrive(imbalance_dij);
+      RYUJIN_OMP_BARRIER
+      LoadImbalance::depart(imbalance_dij);
+
+      RYUJIN_OMP_SINGLE
+      alpha_dispatch.finalize();
+
+      RYUJIN_OMP_MASTER
+      stop_timer(section_dij, traffic_dij_);
     }
 
     /*
@@ -362,15 +810,13 @@ namespace ryujin
      * -------------------------------------------------------------------------
      */
 
-    std::atomic<Number> tau_max{std::numeric_limits<Number>::infinity()};
-
     {
-      Scope scope(computing_timer_,
-                  scoped_name("compute bdry d_ij, diag d_ii, and tau_max"));
+      RYUJIN_OMP_MASTER
+      start_timer(section_tau);
+
+      LoadImbalance::begin(imbalance_tau);
 
-      /* Parallel region */
-      RYUJIN_PARALLEL_REGION_BEGIN
-      LIKWID_MARKER_START(("time_step_" + std::to_string(step_no)).c_str());
+      LIKWID_MARKER_START(("time_step_" + std::to_string(marker_tau)).c_str());
 
       /* Complete d_ij at boundary: */
 
@@ -396,7 +842,7 @@ namespace ryujin
 
       /* Symmetrize d_ij: */
 
-      RYUJIN_OMP_FOR
+      RYUJIN_OMP_FOR_NOWAIT
       for (unsigned int i = 0; i < n_owned; ++i) {
 
         /* Skip constrained degrees of freedom: */
@@ -435,21 +881,34 @@ namespace ryujin
         }
       }
 
-      LIKWID_MARKER_STOP(("time_step_" + std::to_string(step_no)).c_str());
-      RYUJIN_PARALLEL_REGION_END
+      LIKWID_MARKER_STOP(("time_step_" + std::to_string(marker_tau)).c_str());
+
+      LoadImbalance::arrive(imbalance_tau);
+      RYUJIN_OMP_BARRIER
+      LoadImbalance::depart(imbalance_tau);
     }
 
+    /*
+     * All timers (and the associated traffic and performance counter
+     * bookkeeping) are exclusively started and stopped by the master
+     * thread. We thus perform the reduction of tau_max in a master
+     * section followed by an explicit barrier instead of a single
+     * section.
+     */
+
+    RYUJIN_OMP_MASTER
     {
-      Scope scope(computing_timer_,
-                  scoped_name("synchronization barrier", false));
+      stop_timer(section_tau, traffic_tau_);
+      start_timer(section_barrier);
 
       /* MPI Barrier: */
       tau_max.store(Utilities::MPI::min(tau_max.load(), mpi_communicator_));
 
-      AssertThrow(
-          !std::isnan(tau_max) && !std::isinf(tau_max) && tau_max > 0.,
-          ExcMessage(
-              "I'm sorry, Dave. I'm afraid I can't do that.\nWe crashed."));
+      /*
+       * We must not throw from within the parallel region. Record the
+       * failure and raise the exception after the region has ended.
+       */
+      crashed = std::isnan(tau_max) || std::isinf(tau_max) || !(tau_max > 0.);
 
       tau = (tau == Number(0.) ? tau_max.load() : tau);
 
@@ -458,486 +917,682 @@ namespace ryujin
       std::cout << "        perform time-step with tau = " << tau << std::endl;
 #endif
 
-      if (precompute_only_) {
-#ifdef DEBUG_OUTPUT
-        std::cout << "        return early" << std::endl;
-#endif
-        return Number(0.);
-      }
-    }
-
-    /*
-     * -------------------------------------------------------------------------
-     * Step 3: Low-order update, also compute limiter bounds, R_i
-     * -------------------------------------------------------------------------
-     */
-
-    {
-      Scope scope(computing_timer_,
-                  scoped_name("l.-o. update, compute bounds, r_i, and p_ij"));
-
-      SynchronizationDispatch synchronization_dispatch([&]() {
-        r_.update_ghost_values_start(channel++);
-        source_.update_ghost_values_start(channel++);
-        source_r_.update_ghost_values_start(channel++);
-        r_.update_ghost_values_finish();
-        source_.update_ghost_values_finish();
-        source_r_.update_ghost_values_finish();
-      });
-
-      const Number weight =
-          -std::accumulate(stage_weights.begin(), stage_weights.end(), -1.);
-
-      /* Parallel region */
-      RYUJIN_PARALLEL_REGION_BEGIN
-      LIKWID_MARKER_START(("time_step_" + std::to_string(step_no)).c_str());
+      return_early = crashed || precompute_only_;
 
-      auto loop = [&](auto sentinel, unsigned int left, unsigned int right) {
-        using T = decltype(sentinel);
-        unsigned int stride_size = get_stride_size<T>;
-
-        const auto view = hyperbolic_system_->template view<dim, T>();
-        using View = typename HyperbolicSystem::template View<dim, T>;
-
-        /* Stored thread locally: */
-        using Limiter = typename Description::template Limiter<dim, T>;
-        Limiter limiter(*hyperbolic_system_, new_precomputed);
-        bool thread_ready = false;
-
-        RYUJIN_OMP_FOR
-        for (unsigned int i = left; i < right; i += stride_size) {
-
-          /* Skip constrained degrees of freedom: */
-          const unsigned int row_length = sparsity_simd.row_length(i);
-          if (row_length == 1)
-            continue;
-
-          synchronization_dispatch.check(
-              thread_ready, i >= n_export_indices && i < n_internal);
-
-          const auto U_i = old_U.template get_tensor<T>(i);
-          const auto flux_i = view.flux_contribution(
-              new_precomputed, precomputed_initial_, i, U_i);
-
-          using flux_contribution_type = typename View::flux_contribution_type;
-          std::array<flux_contribution_type, stages> flux_iHs;
-          for (int s = 0; s < stages; ++s) {
-            const auto temp = stage_U[s].get().template get_tensor<T>(i);
-            flux_iHs[s] = view.flux_contribution(
-                stage_precomputed[s].get(), precomputed_initial_, i, temp);
-          }
-
-          auto U_i_new = U_i;
-          using state_type = typename View::state_type;
-          state_type F_iH;
-
-          const auto alpha_i = load_value<T>(alpha_, i);
-          const auto m_i = load_value<T>(lumped_mass_matrix, i);
-          const auto m_i_inv = load_value<T>(lumped_mass_matrix_inverse, i);
+      stop_timer(section_barrier, TrafficEstimate());
+    }
 
-          limiter.reset(i);
+    RYUJIN_OMP_BARRIER
 
-          /* Sources: */
-          state_type S_i_new;
-          state_type S_iH;
-          if constexpr (View::have_source_terms) {
-            S_i_new = view.low_order_nodal_source(new_precomputed, i, U_i);
-            S_iH = view.high_order_nodal_source(new_precomputed, i, U_i);
-          }
+    if (!return_early) {
 
-          const unsigned int *js = sparsity_simd.columns(i);
-          for (unsigned int col_idx = 0; col_idx < row_length;
-               ++col_idx, js += stride_size) {
+      /*
+       * -----------------------------------------------------------------------
+       * Step 3: Low-order update, also compute limiter bounds, R_i
+       * -----------------------------------------------------------------------
+       */
 
-            const auto U_j = old_U.template get_tensor<T>(js);
+      {
+        RYUJIN_OMP_MASTER
+        start_timer(section_low_order);
 
-            const auto alpha_j = load_value<T>(alpha_, js);
+        LoadImbalance::begin(imbalance_low_order);
 
-            const auto d_ij = dij_matrix_.template get_entry<T>(i, col_idx);
-            const auto d_ijH = d_ij * (alpha_i + alpha_j) * Number(.5);
+        LIKWID_MARKER_START(
+            ("time_step_" + std::to_string(marker_low_order)).c_str());
 
-            const auto c_ij = cij_matrix.template get_tensor<T>(i, col_idx);
-            const auto d_ij_inv = Number(1.) / d_ij;
+        auto loop = [&](auto sentinel, unsigned int left, unsigned int right) {
+          using T = decltype(sentinel);
+          unsigned int stride_size = get_stride_size<T>;
 
-            const auto beta_ij =
-                betaij_matrix.template get_entry<T>(i, col_idx);
+          const auto view = hyperbolic_system_->template view<dim, T>();
+          using View = typename HyperbolicSystem::template View<dim, T>;
 
-            const auto flux_j = view.flux_contribution(
-                new_precomputed, precomputed_initial_, js, U_j);
+          /* Stored thread locally: */
+          using Limiter = typename Description::template Limiter<dim, T>;
+          Limiter limiter(*hyperbolic_system_, new_precomputed);
+          bool thread_ready = false;
 
-            /*
-             * Compute low-order flux and limiter bounds:
-             */
+          const unsigned int first_block =
+              row_block_schedule_.block_of_row(left);
+          const unsigned int last_block =
+              row_block_schedule_.block_of_row(right);
+
+          RYUJIN_OMP_FOR_NOWAIT
+          for (unsigned int b = first_block; b < last_block; ++b) {
+            const auto [block_left, block_right] =
+                row_block_schedule_.block_range(b);
+            for (unsigned int i = block_left; i < block_right;
+                 i += stride_size) {
+
+              /* Skip constrained degrees of freedom: */
+              const unsigned int row_length = sparsity_simd.row_length(i);
+              if (row_length == 1)
+                continue;
+
+              r_dispatch.check(thread_ready,
+                               i >= n_export_indices && i < n_internal);
+
+              const auto U_i = old_U.template get_tensor<T>(i);
+              const auto flux_i = view.flux_contribution(
+                  new_precomputed, precomputed_initial_, i, U_i);
+
+              using flux_contribution_type =
+                  typename View::flux_contribution_type;
+              std::array<flux_contribution_type, stages> flux_iHs;
+              for (int s = 0; s < stages; ++s) {
+                const auto temp = stage_U[s].get().template get_tensor<T>(i);
+                flux_iHs[s] = view.flux_contribution(
+                    stage_precomputed[s].get(), precomputed_initial_, i, temp);
+              }
 
-            const auto flux_ij = view.flux(flux_i, flux_j);
-            U_i_new += tau * m_i_inv * contract(flux_ij, c_ij);
-            auto P_ij = -contract(flux_ij, c_ij);
+              auto U_i_new = U_i;
+              using state_type = typename View::state_type;
+              state_type F_iH;
 
-            using state_type = typename View::state_type;
-            state_type Q_ij;
-            if constexpr (View::have_source_terms) {
-              const auto B_ij =
-                  view.affine_shift_stencil_source(flux_i, flux_j, d_ij, c_ij);
-              const auto S_ij =
-                  view.low_order_stencil_source(flux_i, flux_j, d_ij, c_ij);
+              const auto alpha_i = load_value<T>(alpha_, i);
+              const auto m_i = load_value<T>(lumped_mass_matrix, i);
+              const auto m_i_inv = load_value<T>(lumped_mass_matrix_inverse, i);
 
-              U_i_new -= tau * m_i_inv * B_ij;
-              S_i_new += tau * m_i_inv * (B_ij + S_ij);
-              Q_ij -= S_ij;
-            }
+              limiter.reset(i);
 
-            if constexpr (View::have_equilibrated_states) {
-              /* Use star states for low-order update: */
-              const auto &[U_star_ij, U_star_ji] =
-                  view.equilibrated_states(flux_i, flux_j);
-              U_i_new += tau * m_i_inv * d_ij * (U_star_ji - U_star_ij);
-              F_iH += d_ijH * (U_star_ji - U_star_ij);
-              P_ij += (d_ijH - d_ij) * (U_star_ji - U_star_ij);
-
-            } else {
-              /* Regular low-order update with unmodified states: */
-              U_i_new += tau * m_i_inv * d_ij * (U_j - U_i);
-              F_iH += d_ijH * (U_j - U_i);
-              P_ij += (d_ijH - d_ij) * (U_j - U_i);
-            }
-
-            limiter.accumulate(
-                js, U_i, U_j, flux_i, flux_j, d_ij_inv * c_ij, beta_ij);
-
-            /*
-             * Compute high-order fluxes:
-             */
-
-            if constexpr (View::have_high_order_flux) {
-              const auto high_order_flux_ij =
-                  view.high_order_flux(flux_i, flux_j);
-              F_iH += weight * contract(high_order_flux_ij, c_ij);
-              P_ij += weight * contract(high_order_flux_ij, c_ij);
-            } else {
-              F_iH += weight * contract(flux_ij, c_ij);
-              P_ij += weight * contract(flux_ij, c_ij);
-            }
+              /* Sources: */
+              state_type S_i_new;
+              state_type S_iH;
+              if constexpr (View::have_source_terms) {
+                S_i_new = view.low_order_nodal_source(new_precomputed, i, U_i);
+                S_iH = view.high_order_nodal_source(new_precomputed, i, U_i);
+              }
 
-            if constexpr (View::have_source_terms) {
-              const auto S_ijH =
-                  view.high_order_stencil_source(flux_i, flux_j, d_ijH, c_ij);
-              S_iH += weight * S_ijH;
-              Q_ij += weight * S_ijH;
-            }
+              const unsigned int *js = sparsity_simd.columns(i);
+              for (unsigned int col_idx = 0; col_idx < row_length;
+                   ++col_idx, js += stride_size) {
+
+                const auto U_j = old_U.template get_tensor<T>(js);
+
+                const auto alpha_j = load_value<T>(alpha_, js);
+
+                const auto d_ij = dij_matrix_.template get_entry<T>(i, col_idx);
+                const auto d_ijH = d_ij * (alpha_i + alpha_j) * Number(.5);
+
+                const auto c_ij = cij_matrix.template get_tensor<T>(i, col_idx);
+                const auto d_ij_inv = Number(1.) / d_ij;
+
+                const auto beta_ij =
+                    betaij_matrix.template get_entry<T>(i, col_idx);
+
+                const auto flux_j = view.flux_contribution(
+                    new_precomputed, precomputed_initial_, js, U_j);
+
+                /*
+                 * Compute low-order flux and limiter bounds:
+                 */
+
+                const auto flux_ij = view.flux(flux_i, flux_j);
+                U_i_new += tau * m_i_inv * contract(flux_ij, c_ij);
+                auto P_ij = -contract(flux_ij, c_ij);
+
+                using state_type = typename View::state_type;
+                state_type Q_ij;
+                if constexpr (View::have_source_terms) {
+                  const auto B_ij = view.affine_shift_stencil_source(
+                      flux_i, flux_j, d_ij, c_ij);
+                  const auto S_ij =
+                      view.low_order_stencil_source(flux_i, flux_j, d_ij, c_ij);
+
+                  U_i_new -= tau * m_i_inv * B_ij;
+                  S_i_new += tau * m_i_inv * (B_ij + S_ij);
+                  Q_ij -= S_ij;
+                }
+
+                if constexpr (View::have_equilibrated_states) {
+                  /* Use star states for low-order update: */
+                  const auto &[U_star_ij, U_star_ji] =
+                      view.equilibrated_states(flux_i, flux_j);
+                  U_i_new += tau * m_i_inv * d_ij * (U_star_ji - U_star_ij);
+                  F_iH += d_ijH * (U_star_ji - U_star_ij);
+                  P_ij += (d_ijH - d_ij) * (U_star_ji - U_star_ij);
+
+                } else {
+                  /* Regular low-order update with unmodified states: */
+                  U_i_new += tau * m_i_inv * d_ij * (U_j - U_i);
+                  F_iH += d_ijH * (U_j - U_i);
+                  P_ij += (d_ijH - d_ij) * (U_j - U_i);
+                }
+
+                limiter.accumulate(
+                    js, U_i, U_j, flux_i, flux_j, d_ij_inv * c_ij, beta_ij);
+
+                /*
+                 * Compute high-order fluxes:
+                 */
+
+                if constexpr (View::have_high_order_flux) {
+                  const auto high_order_flux_ij =
+                      view.high_order_flux(flux_i, flux_j);
+                  F_iH += weight * contract(high_order_flux_ij, c_ij);
+                  P_ij += weight * contract(high_order_flux_ij, c_ij);
+                } else {
+                  F_iH += weight * contract(flux_ij, c_ij);
+                  P_ij += weight * contract(flux_ij, c_ij);
+                }
+
+                if constexpr (View::have_source_terms) {
+                  const auto S_ijH = view.high_order_stencil_source(
+                      flux_i, flux_j, d_ijH, c_ij);
+                  S_iH += weight * S_ijH;
+                  Q_ij += weight * S_ijH;
+                }
+
+                for (int s = 0; s < stages; ++s) {
+                  const auto U_jH =
+                      stage_U[s].get().template get_tensor<T>(js);
+                  const auto p =
+                      view.flux_contribution(stage_precomputed[s].get(),
+                                             precomputed_initial_,
+                                             js,
+                                             U_jH);
+
+                  if constexpr (View::have_high_order_flux) {
+                    const auto high_order_flux_ij =
+                        view.high_order_flux(flux_iHs[s], p);
+                    F_iH +=
+                        stage_weights[s] * contract(high_order_flux_ij, c_ij);
+                    P_ij +=
+                        stage_weights[s] * contract(high_order_flux_ij, c_ij);
+                  } else {
+                    const auto flux_ij = view.flux(flux_iHs[s], p);
+                    F_iH += stage_weights[s] * contract(flux_ij, c_ij);
+                    P_ij += stage_weights[s] * contract(flux_ij, c_ij);
+                  }
+
+                  if constexpr (View::have_source_terms) {
+                    auto S_ijH = view.high_order_stencil_source(
+                        flux_iHs[s], p, d_ijH, c_ij);
+                    S_iH += stage_weights[s] * S_ijH;
+                    Q_ij += stage_weights[s] * S_ijH;
+                  }
+                }
+
+                if (!recompute_p_ij_)
+                  pij_matrix_.write_tensor(P_ij, i, col_idx, streaming_pij_);
+                if constexpr (View::have_source_terms)
+                  qij_matrix_.write_tensor(Q_ij, i, col_idx, streaming_pij_);
+              }
 
-            for (int s = 0; s < stages; ++s) {
-              const auto U_jH = stage_U[s].get().template get_tensor<T>(js);
-              const auto p = view.flux_contribution(
-                  stage_precomputed[s].get(), precomputed_initial_, js, U_jH);
-
-              if constexpr (View::have_high_order_flux) {
-                const auto high_order_flux_ij =
-                    view.high_order_flux(flux_iHs[s], p);
-                F_iH += stage_weights[s] * contract(high_order_flux_ij, c_ij);
-                P_ij += stage_weights[s] * contract(high_order_flux_ij, c_ij);
-              } else {
-                const auto flux_ij = view.flux(flux_iHs[s], p);
-                F_iH += stage_weights[s] * contract(flux_ij, c_ij);
-                P_ij += stage_weights[s] * contract(flux_ij, c_ij);
+#ifdef CHECK_BOUNDS
+              if (!view.is_admissible(U_i_new)) {
+                restart_needed = true;
               }
+#endif
+
+              new_U.template write_tensor<T>(U_i_new, i, streaming_state_);
+              r_.template write_tensor<T>(F_iH, i, streaming_r_);
 
               if constexpr (View::have_source_terms) {
-                auto S_ijH =
-                    view.high_order_stencil_source(flux_iHs[s], p, d_ijH, c_ij);
-                S_iH += stage_weights[s] * S_ijH;
-                Q_ij += stage_weights[s] * S_ijH;
+                source_.template write_tensor<T>(S_i_new, i, streaming_state_);
+                source_r_.template write_tensor<T>(S_iH, i, streaming_r_);
               }
-            }
 
-            pij_matrix_.write_tensor(P_ij, i, col_idx, true);
-            if constexpr (View::have_source_terms)
-              qij_matrix_.write_tensor(Q_ij, i, col_idx, true);
-          }
-
-#ifdef CHECK_BOUNDS
-          if (!view.is_admissible(U_i_new)) {
-            restart_needed = true;
+              const auto hd_i = m_i * measure_of_omega_inverse;
+              limiter.apply_relaxation(hd_i, limiter_relaxation_factor_);
+              bounds_.template write_tensor<T>(
+                  limiter.bounds(), i, streaming_bounds_);
+            }
+            row_block_schedule_.mark_done(b, epoch_low_order);
           }
-#endif
+        };
 
-          new_U.template write_tensor<T>(U_i_new, i);
-          r_.template write_tensor<T>(F_iH, i);
+        /* Parallel non-vectorized loop: */
+        loop(Number(), n_internal, n_owned);
+        /* Parallel vectorized SIMD loop: */
+        loop(VA(), 0, n_internal);
 
-          if constexpr (View::have_source_terms) {
-            source_.template write_tensor<T>(S_i_new, i);
-            source_r_.template write_tensor<T>(S_iH, i);
+        LIKWID_MARKER_STOP(
+            ("time_step_" + std::to_string(marker_low_order)).c_str());
+
+        if (row_block_schedule_.track_dependencies()) {
+          LoadImbalance::arrive(imbalance_low_order);
+
+          /*
+           * A single thread waits for the low-order update to finish and
+           * performs the ghost exchange. All other threads proceed
+           * immediately with row blocks that do not depend on ghost
+           * values.
+           */
+          RYUJIN_OMP_SINGLE_NOWAIT
+          {
+            row_block_schedule_.wait_for_rows(n_owned, epoch_low_order);
+            r_dispatch.finalize();
+            row_block_schedule_.mark_ghost_values_ready(epoch_low_order);
           }
-
-          const auto hd_i = m_i * measure_of_omega_inverse;
-          limiter.apply_relaxation(hd_i, limiter_relaxation_factor_);
-          bounds_.template write_tensor<T>(limiter.bounds(), i);
+        } else {
+          LoadImbalance::arrive(imbalance_low_order);
+          RYUJIN_OMP_BARRIER
+          LoadImbalance::depart(imbalance_low_order);
+          RYUJIN_OMP_SINGLE
+          r_dispatch.finalize();
         }
-      };
-
-      /* Parallel non-vectorized loop: */
-      loop(Number(), n_internal, n_owned);
-      /* Parallel vectorized SIMD loop: */
-      loop(VA(), 0, n_internal);
-
-      LIKWID_MARKER_STOP(("time_step_" + std::to_string(step_no)).c_str());
-      RYUJIN_PARALLEL_REGION_END
-    }
-
-    /*
-     * -------------------------------------------------------------------------
-     * Step 4: Compute second part of P_ij, and l_ij (first round):
-     * -------------------------------------------------------------------------
-     */
-
-    if (limiter_iter_ != 0) {
-      Scope scope(computing_timer_, scoped_name("compute p_ij, and l_ij"));
-
-      SynchronizationDispatch synchronization_dispatch([&]() {
-        lij_matrix_.update_ghost_rows_start(channel++);
-        lij_matrix_.update_ghost_rows_finish();
-      });
-
-      RYUJIN_PARALLEL_REGION_BEGIN
-      LIKWID_MARKER_START(("time_step_" + std::to_string(step_no)).c_str());
 
-      auto loop = [&](auto sentinel, unsigned int left, unsigned int right) {
-        using T = decltype(sentinel);
-        unsigned int stride_size = get_stride_size<T>;
-
-        using View = typename HyperbolicSystem::template View<dim, T>;
-
-        /* Stored thread locally: */
-        bool thread_ready = false;
-
-        RYUJIN_OMP_FOR
-        for (unsigned int i = left; i < right; i += stride_size) {
-
-          /* Skip constrained degrees of freedom: */
-          const unsigned int row_length = sparsity_simd.row_length(i);
-          if (row_length == 1)
-            continue;
-
-          synchronization_dispatch.check(
-              thread_ready, i >= n_export_indices && i < n_internal);
+        RYUJIN_OMP_MASTER
+        stop_timer(section_low_order, traffic_low_order_);
+      }
 
-          const auto bounds =
-              bounds_.template get_tensor<T, std::array<T, n_bounds>>(i);
+      /*
+       * -----------------------------------------------------------------------
+       * Step 4: Compute second part of P_ij, and l_ij (first round):
+       * -----------------------------------------------------------------------
+       */
 
-          const auto m_i_inv = load_value<T>(lumped_mass_matrix_inverse, i);
+      if (limiter_iter_ != 0) {
+        RYUJIN_OMP_MASTER
+        start_timer(section_lij);
 
-          const auto U_i_new = new_U.template get_tensor<T>(i);
+        LoadImbalance::begin(imbalance_lij);
 
-          const auto F_iH = r_.template get_tensor<T>(i);
+        LIKWID_MARKER_START(
+            ("time_step_" + std::to_string(marker_lij)).c_str());
 
+        auto loop = [&](auto sentinel, unsigned int left, unsigned int right) {
+          using T = decltype(sentinel);
+          unsigned int stride_size = get_stride_size<T>;
 
+          const auto view = hyperbolic_system_->template view<dim, T>();
+          using View = typename HyperbolicSystem::template View<dim, T>;
           using state_type = typename View::state_type;
-          state_type S_iH;
-          if constexpr (View::have_source_terms)
-            S_iH = source_r_.template get_tensor<T>(i);
-
-          const auto lambda_inv = Number(row_length - 1);
-          const auto factor = tau * m_i_inv * lambda_inv;
+          using flux_contribution_type = typename View::flux_contribution_type;
 
-          const unsigned int *js = sparsity_simd.columns(i);
-          for (unsigned int col_idx = 0; col_idx < row_length;
-               ++col_idx, js += stride_size) {
+          /* Stored thread locally: */
+          bool thread_ready = false;
 
-            /*
-             * Mass matrix correction:
-             */
-
-            const auto m_j_inv = load_value<T>(lumped_mass_matrix_inverse, js);
-            const auto m_ij = mass_matrix.template get_entry<T>(i, col_idx);
-
-            const auto b_ij = (col_idx == 0 ? T(1.) : T(0.)) - m_ij * m_j_inv;
-            /* m_ji = m_ij  so let's simply use m_ij: */
-            const auto b_ji = (col_idx == 0 ? T(1.) : T(0.)) - m_ij * m_i_inv;
-
-            auto P_ij = pij_matrix_.template get_tensor<T>(i, col_idx);
-            const auto F_jH = r_.template get_tensor<T>(js);
-            P_ij += b_ij * F_jH - b_ji * F_iH;
-            P_ij *= factor;
-            pij_matrix_.write_tensor(P_ij, i, col_idx);
-
-            if constexpr (View::have_source_terms) {
-              auto Q_ij = qij_matrix_.template get_tensor<T>(i, col_idx);
-              const auto S_jH = source_r_.template get_tensor<T>(js);
-              Q_ij += b_ij * S_jH - b_ji * S_iH;
-              Q_ij *= factor;
-              qij_matrix_.write_tensor(Q_ij, i, col_idx);
+          const unsigned int first_block =
+              row_block_schedule_.block_of_row(left);
+          const unsigned int last_block =
+              row_block_schedule_.block_of_row(right);
+
+          RYUJIN_OMP_FOR_NOWAIT
+          for (unsigned int b = first_block; b < last_block; ++b) {
+            row_block_schedule_.wait_for_dependencies(b, epoch_low_order);
+            const auto [block_left, block_right] =
+                row_block_schedule_.block_range(b);
+            for (unsigned int i = block_left; i < block_right;
+                 i += stride_size) {
+
+              /* Skip constrained degrees of freedom: */
+              const unsigned int row_length = sparsity_simd.row_length(i);
+              if (row_length == 1)
+                continue;
+
+              lij_dispatch.check(thread_ready,
+                                 i >= n_export_indices && i < n_internal);
+
+              const auto bounds =
+                  bounds_.template get_tensor<T, std::array<T, n_bounds>>(i);
+
+              const auto m_i_inv = load_value<T>(lumped_mass_matrix_inverse, i);
+
+              const auto U_i_new = new_U.template get_tensor<T>(i);
+
+              const auto F_iH = r_.template get_tensor<T>(i);
+
+              state_type U_i;
+              flux_contribution_type flux_i;
+              std::array<flux_contribution_type, stages> flux_iHs;
+              T alpha_i;
+              if (recompute_p_ij_)
+                recompute_row(view, i, U_i, flux_i, flux_iHs, alpha_i);
+
+              state_type S_iH;
+              if constexpr (View::have_source_terms)
+                S_iH = source_r_.template get_tensor<T>(i);
+
+              const auto lambda_inv = Number(row_length - 1);
+              const auto factor = tau * m_i_inv * lambda_inv;
+
+              const unsigned int *js = sparsity_simd.columns(i);
+              for (unsigned int col_idx = 0; col_idx < row_length;
+                   ++col_idx, js += stride_size) {
+
+                /*
+                 * Mass matrix correction:
+                 */
+
+                const auto m_j_inv =
+                    load_value<T>(lumped_mass_matrix_inverse, js);
+                const auto m_ij = mass_matrix.template get_entry<T>(i, col_idx);
+
+                const auto b_ij =
+                    (col_idx == 0 ? T(1.) : T(0.)) - m_ij * m_j_inv;
+                /* m_ji = m_ij  so let's simply use m_ij: */
+                const auto b_ji =
+                    (col_idx == 0 ? T(1.) : T(0.)) - m_ij * m_i_inv;
+
+                state_type P_ij;
+                if (recompute_p_ij_)
+                  P_ij = recompute_p_ij(
+                      view, i, js, col_idx, U_i, flux_i, flux_iHs, alpha_i);
+                else
+                  P_ij = pij_matrix_.template get_tensor<T>(i, col_idx);
+                const auto F_jH = r_.template get_tensor<T>(js);
+                P_ij += b_ij * F_jH - b_ji * F_iH;
+                P_ij *= factor;
+                if (!recompute_p_ij_)
+                  pij_matrix_.write_tensor(
+                      P_ij, i, col_idx, streaming_pij_update_);
+
+                if constexpr (View::have_source_terms) {
+                  auto Q_ij = qij_matrix_.template get_tensor<T>(i, col_idx);
+                  const auto S_jH = source_r_.template get_tensor<T>(js);
+                  Q_ij += b_ij * S_jH - b_ji * S_iH;
+                  Q_ij *= factor;
+                  qij_matrix_.write_tensor(
+                      Q_ij, i, col_idx, streaming_pij_update_);
+                }
+
+                /*
+                 * Compute limiter bounds:
+                 */
+
+                const auto &[l_ij, success] =
+                    Description::template Limiter<dim, T>::limit(
+                        *hyperbolic_system_,
+                        bounds,
+                        U_i_new,
+                        P_ij,
+                        limiter_newton_tolerance_,
+                        limiter_newton_max_iter_);
+                if (quantize_lij_)
+                  lij_quantized_.template write_entry<T>(l_ij, i, col_idx);
+                else
+                  lij_matrix_.template write_entry<T>(
+                      l_ij, i, col_idx, streaming_lij_);
+
+                /* Unsuccessful with current CFL, force a restart. */
+                if (!success)
+                  restart_needed = true;
+              }
             }
-
-            /*
-             * Compute limiter bounds:
-             */
-
-            const auto &[l_ij, success] =
-                Description::template Limiter<dim, T>::limit(
-                    *hyperbolic_system_,
-                    bounds,
-                    U_i_new,
-                    P_ij,
-                    limiter_newton_tolerance_,
-                    limiter_newton_max_iter_);
-            lij_matrix_.template write_entry<T>(l_ij, i, col_idx, true);
-
-            /* Unsuccessful with current CFL, force a restart. */
-            if (!success)
-              restart_needed = true;
+            row_block_schedule_.mark_done(b, epoch_lij);
           }
-        }
-      };
-
-      /* Parallel non-vectorized loop: */
-      loop(Number(), n_internal, n_owned);
-      /* Parallel vectorized SIMD loop: */
-      loop(VA(), 0, n_internal);
-
-      LIKWID_MARKER_STOP(("time_step_" + std::to_string(step_no)).c_str());
-      RYUJIN_PARALLEL_REGION_END
-    }
-
-    /*
-     * -------------------------------------------------------------------------
-     * Step 5, 6: Perform high-order update:
-     *
-     *   Symmetrize l_ij
-     *   High-order update: += l_ij * lambda * P_ij
-     *   Compute next l_ij
-     * -------------------------------------------------------------------------
-     */
+        };
 
-    for (unsigned int pass = 0; pass < limiter_iter_; ++pass) {
-      bool last_round = (pass + 1 == limiter_iter_);
+        /* Parallel non-vectorized loop: */
+        loop(Number(), n_internal, n_owned);
+        /* Parallel vectorized SIMD loop: */
+        loop(VA(), 0, n_internal);
 
-      std::string additional_step = (last_round ? "" : ", next l_ij");
-      Scope scope(
-          computing_timer_,
-          scoped_name("symmetrize l_ij, h.-o. update" + additional_step));
+        LIKWID_MARKER_STOP(
+            ("time_step_" + std::to_string(marker_lij)).c_str());
 
-      if ((limiter_iter_ == 2) && last_round) {
-        std::swap(lij_matrix_, lij_matrix_next_);
-      }
+        if (row_block_schedule_.track_dependencies()) {
+          LoadImbalance::arrive(imbalance_lij);
 
-      SynchronizationDispatch synchronization_dispatch([&]() {
-        if (!last_round) {
-          lij_matrix_next_.update_ghost_rows_start(channel++);
-          lij_matrix_next_.update_ghost_rows_finish();
+          RYUJIN_OMP_SINGLE_NOWAIT
+          {
+            row_block_schedule_.wait_for_rows(n_owned, epoch_lij);
+            lij_dispatch.finalize();
+            row_block_schedule_.mark_ghost_values_ready(epoch_lij);
+          }
+        } else {
+          LoadImbalance::arrive(imbalance_lij);
+          RYUJIN_OMP_BARRIER
+          LoadImbalance::depart(imbalance_lij);
+          RYUJIN_OMP_SINGLE
+          lij_dispatch.finalize();
         }
-      });
-
-      RYUJIN_PARALLEL_REGION_BEGIN
-      LIKWID_MARKER_START(("time_step_" + std::to_string(step_no)).c_str());
 
-      auto loop = [&](auto sentinel, unsigned int left, unsigned int right) {
-        using T = decltype(sentinel);
-        unsigned int stride_size = get_stride_size<T>;
+        RYUJIN_OMP_MASTER
+        stop_timer(section_lij, traffic_lij_);
+      }
 
-        using View = typename HyperbolicSystem::template View<dim, T>;
+      /*
+       * -----------------------------------------------------------------------
+       * Step 5, 6: Perform high-order update:
+       *
+       *   Symmetrize l_ij
+       *   High-order update: += l_ij * lambda * P_ij
+       *   Compute next l_ij
+       * -----------------------------------------------------------------------
+       */
 
-        /* Stored thread locally: */
-        AlignedVector<T> lij_row;
-        bool thread_ready = false;
+      for (unsigned int current_pass = 0; current_pass < limiter_iter_;
+           ++current_pass) {
+        bool last_round = (current_pass + 1 == limiter_iter_);
+
+        if (current_pass != 0) {
+          RYUJIN_OMP_SINGLE
+          {
+            pass = current_pass;
+            if ((limiter_iter_ == 2) && last_round) {
+              std::swap(lij_matrix_, lij_matrix_next_);
+              std::swap(lij_quantized_, lij_quantized_next_);
+            }
+          }
+        }
 
-        RYUJIN_OMP_FOR
-        for (unsigned int i = left; i < right; i += stride_size) {
+        RYUJIN_OMP_MASTER
+        start_timer(section_high_order[current_pass]);
 
-          /* Skip constrained degrees of freedom: */
-          const unsigned int row_length = sparsity_simd.row_length(i);
-          if (row_length == 1)
-            continue;
+        LoadImbalance::begin(imbalance_high_order[current_pass]);
 
-          synchronization_dispatch.check(
-              thread_ready, i >= n_export_indices && i < n_internal);
+        LIKWID_MARKER_START(
+            ("time_step_" + std::to_string(marker_high_order[current_pass]))
+                .c_str());
 
-          auto U_i_new = new_U.template get_tensor<T>(i);
+        auto loop = [&](auto sentinel, unsigned int left, unsigned int right) {
+          using T = decltype(sentinel);
+          unsigned int stride_size = get_stride_size<T>;
 
+          const auto view = hyperbolic_system_->template view<dim, T>();
+          using View = typename HyperbolicSystem::template View<dim, T>;
           using state_type = typename View::state_type;
-          state_type S_i_new;
-          if constexpr (View::have_source_terms)
-            S_i_new = source_.template get_tensor<T>(i);
-
-          const Number lambda = Number(1.) / Number(row_length - 1);
-          lij_row.resize_fast(row_length);
-
-          for (unsigned int col_idx = 0; col_idx < row_length; ++col_idx) {
-
-            const auto l_ij = std::min(
-                lij_matrix_.template get_entry<T>(i, col_idx),
-                lij_matrix_.template get_transposed_entry<T>(i, col_idx));
-
-            const auto p_ij = pij_matrix_.template get_tensor<T>(i, col_idx);
+          using flux_contribution_type = typename View::flux_contribution_type;
 
-            U_i_new += l_ij * lambda * p_ij;
+          /* Stored thread locally: */
+          AlignedVector<T> lij_row;
+          AlignedVector<state_type> pij_row;
+          bool thread_ready = false;
 
-            if constexpr (View::have_source_terms) {
-              const auto q_ij = qij_matrix_.template get_tensor<T>(i, col_idx);
-              S_i_new += l_ij * lambda * q_ij;
-            }
+          const unsigned int first_block =
+              row_block_schedule_.block_of_row(left);
+          const unsigned int last_block =
+              row_block_schedule_.block_of_row(right);
+
+          RYUJIN_OMP_FOR_NOWAIT
+          for (unsigned int b = first_block; b < last_block; ++b) {
+            if (current_pass == 0)
+              row_block_schedule_.wait_for_dependencies(b, epoch_lij);
+            const auto [block_left, block_right] =
+                row_block_schedule_.block_range(b);
+            for (unsigned int i = block_left; i < block_right;
+                 i += stride_size) {
+
+              /* Skip constrained degrees of freedom: */
+              const unsigned int row_length = sparsity_simd.row_length(i);
+              if (row_length == 1)
+                continue;
+
+              lij_next_dispatch.check(thread_ready,
+                                      i >= n_export_indices && i < n_internal);
+
+              auto U_i_new = new_U.template get_tensor<T>(i);
+
+              state_type S_i_new;
+              if constexpr (View::have_source_terms)
+                S_i_new = source_.template get_tensor<T>(i);
+
+              const Number lambda = Number(1.) / Number(row_length - 1);
+              lij_row.resize_fast(row_length);
+
+              state_type U_i;
+              flux_contribution_type flux_i;
+              std::array<flux_contribution_type, stages> flux_iHs;
+              T alpha_i;
+              state_type F_iH;
+              T m_i_inv;
+              T factor;
+              if (recompute_p_ij_) {
+                recompute_row(view, i, U_i, flux_i, flux_iHs, alpha_i);
+                F_iH = r_.template get_tensor<T>(i);
+                m_i_inv = load_value<T>(lumped_mass_matrix_inverse, i);
+                factor = tau * m_i_inv * Number(row_length - 1);
+                pij_row.resize_fast(row_length);
+              }
 
-            if (!last_round)
-              lij_row[col_idx] = l_ij;
-          }
+              const unsigned int *js = sparsity_simd.columns(i);
+              for (unsigned int col_idx = 0; col_idx < row_length;
+                   ++col_idx, js += stride_size) {
+
+                const auto l_ij =
+                    quantize_lij_
+                        ? std::min(lij_quantized_.template get_entry<T>(
+                                       i, col_idx),
+                                   lij_quantized_
+                                       .template get_transposed_entry<T>(
+                                           i, col_idx))
+                        : std::min(lij_matrix_.template get_entry<T>(
+                                       i, col_idx),
+                                   lij_matrix_.template get_transposed_entry<T>(
+                                       i, col_idx));
+
+                state_type p_ij;
+                if (recompute_p_ij_) {
+                  p_ij = recompute_p_ij(
+                      view, i, js, col_idx, U_i, flux_i, flux_iHs, alpha_i);
+
+                  /* Mass matrix correction and scaling as in Step 4: */
+                  const auto m_j_inv =
+                      load_value<T>(lumped_mass_matrix_inverse, js);
+                  const auto m_ij =
+                      mass_matrix.template get_entry<T>(i, col_idx);
+                  const auto b_ij =
+                      (col_idx == 0 ? T(1.) : T(0.)) - m_ij * m_j_inv;
+                  const auto b_ji =
+                      (col_idx == 0 ? T(1.) : T(0.)) - m_ij * m_i_inv;
+                  const auto F_jH = r_.template get_tensor<T>(js);
+                  p_ij += b_ij * F_jH - b_ji * F_iH;
+                  p_ij *= factor;
+
+                  if (!last_round)
+                    pij_row[col_idx] = p_ij;
+                } else {
+                  p_ij = pij_matrix_.template get_tensor<T>(i, col_idx);
+                }
+
+                U_i_new += l_ij * lambda * p_ij;
+
+                if constexpr (View::have_source_terms) {
+                  const auto q_ij =
+                      qij_matrix_.template get_tensor<T>(i, col_idx);
+                  S_i_new += l_ij * lambda * q_ij;
+                }
+
+                if (!last_round)
+                  lij_row[col_idx] = l_ij;
+              }
 
 #ifdef CHECK_BOUNDS
-          const auto view = hyperbolic_system_->template view<dim, T>();
-          if (!view.is_admissible(U_i_new)) {
-            restart_needed = true;
-          }
+              if (!view.is_admissible(U_i_new)) {
+                restart_needed = true;
+              }
 #endif
 
-          new_U.template write_tensor<T>(U_i_new, i);
-
-          if constexpr (View::have_source_terms)
-            source_.template write_tensor<T>(S_i_new, i);
+              new_U.template write_tensor<T>(U_i_new, i, streaming_state_);
+
+              if constexpr (View::have_source_terms)
+                source_.template write_tensor<T>(S_i_new, i, streaming_state_);
+
+              /* Skip computating l_ij and updating p_ij in the last round */
+              if (last_round)
+                continue;
+
+              const auto bounds =
+                  bounds_.template get_tensor<T, std::array<T, n_bounds>>(i);
+              for (unsigned int col_idx = 0; col_idx < row_length; ++col_idx) {
+
+                const auto old_l_ij = lij_row[col_idx];
+
+                const auto new_p_ij =
+                    (T(1.) - old_l_ij) *
+                    (recompute_p_ij_
+                         ? pij_row[col_idx]
+                         : pij_matrix_.template get_tensor<T>(i, col_idx));
+
+                const auto &[new_l_ij, success] =
+                    Description::template Limiter<dim, T>::limit(
+                        *hyperbolic_system_,
+                        bounds,
+                        U_i_new,
+                        new_p_ij,
+                        limiter_newton_tolerance_,
+                        limiter_newton_max_iter_);
+
+                /* Unsuccessful with current CFL, force a restart. */
+                if (!success)
+                  restart_needed = true;
+
+                /*
+                 * Shortcut: We omit updating the p_ij and q_ij matrices and
+                 * simply write (1 - l_ij^(1)) * l_ij^(2) into the l_ij matrix.
+                 *
+                 * This approach only works for at most two limiting steps.
+                 */
+                const auto entry = (T(1.) - old_l_ij) * new_l_ij;
+                if (quantize_lij_)
+                  lij_quantized_next_.write_entry(entry, i, col_idx);
+                else
+                  lij_matrix_next_.write_entry(
+                      entry, i, col_idx, streaming_lij_next_);
+              }
+            }
+          }
+        };
 
-          /* Skip computating l_ij and updating p_ij in the last round */
-          if (last_round)
-            continue;
+        /* Parallel non-vectorized loop: */
+        loop(Number(), n_internal, n_owned);
+        /* Parallel vectorized SIMD loop: */
+        loop(VA(), 0, n_internal);
 
-          const auto bounds =
-              bounds_.template get_tensor<T, std::array<T, n_bounds>>(i);
-          for (unsigned int col_idx = 0; col_idx < row_length; ++col_idx) {
-
-            const auto old_l_ij = lij_row[col_idx];
-
-            const auto new_p_ij =
-                (T(1.) - old_l_ij) *
-                pij_matrix_.template get_tensor<T>(i, col_idx);
-
-            const auto &[new_l_ij, success] =
-                Description::template Limiter<dim, T>::limit(
-                    *hyperbolic_system_,
-                    bounds,
-                    U_i_new,
-                    new_p_ij,
-                    limiter_newton_tolerance_,
-                    limiter_newton_max_iter_);
-
-            /* Unsuccessful with current CFL, force a restart. */
-            if (!success)
-              restart_needed = true;
-
-            /*
-             * Shortcut: We omit updating the p_ij and q_ij matrices and
-             * simply write (1 - l_ij^(1)) * l_ij^(2) into the l_ij matrix.
-             *
-             * This approach only works for at most two limiting steps.
-             */
-            const auto entry = (T(1.) - old_l_ij) * new_l_ij;
-            lij_matrix_next_.write_entry(entry, i, col_idx, true);
-          }
-        }
-      };
+        LIKWID_MARKER_STOP(
+            ("time_step_" + std::to_string(marker_high_order[current_pass]))
+                .c_str());
+
+        LoadImbalance::arrive(imbalance_high_order[current_pass]);
+        RYUJIN_OMP_BARRIER
+        LoadImbalance::depart(imbalance_high_order[current_pass]);
+
+        RYUJIN_OMP_SINGLE
+        lij_next_dispatch.finalize();
+
+        RYUJIN_OMP_MASTER
+        stop_timer(section_high_order[current_pass],
+                   last_round ? traffic_high_order_last_
+                              : traffic_high_order_);
+      } /* limiter_iter_ */
+    }   /* !return_early */
+
+    RYUJIN_PARALLEL_REGION_END
+
+    /* Skipped phases must not trigger any further communication: */
+    if constexpr (n_precomputation_cycles == 0)
+      precomputed_dispatch.discard();
+    if (return_early)
+      r_dispatch.discard();
+    if (return_early || limiter_iter_ == 0) {
+      lij_dispatch.discard();
+      lij_next_dispatch.discard();
+    }
 
-      /* Parallel non-vectorized loop: */
-      loop(Number(), n_internal, n_owned);
-      /* Parallel vectorized SIMD loop: */
-      loop(VA(), 0, n_internal);
+    AssertThrow(!crashed,
+                ExcMessage(
+                    "I'm sorry, Dave. I'm afraid I can't do that.\nWe crashed."));
 
-      LIKWID_MARKER_STOP(("time_step_" + std::to_string(step_no)).c_str());
-      RYUJIN_PARALLEL_REGION_END
-    } /* limiter_iter_ */
+    if (precompute_only_) {
+#ifdef DEBUG_OUTPUT
+      std::cout << "        return early" << std::endl;
+#endif
+      return Number(0.);
+    }
 
     /* Update sources: */
     using View = typename HyperbolicSystem::template View<dim, Number>;
@@ -1014,4 +1669,24 @@ namespace ryujin
     U.update_ghost_values();
   }
 
+
+  template <typename Description, int dim, typename Number>
+  void HyperbolicModule<Description, dim, Number>::memory_statistics(
+      std::map<std::string, std::size_t> &statistics) const
+  {
+    statistics["HyperbolicModule - dij matrix"] =
+        dij_matrix_.memory_consumption();
+    statistics["HyperbolicModule - lij matrices"] =
+        lij_matrix_.memory_consumption() +
+        lij_matrix_next_.memory_consumption() +
+        lij_quantized_.memory_consumption() +
+        lij_quantized_next_.memory_consumption();
+    statistics["HyperbolicModule - pij matrix"] =
+        pij_matrix_.memory_consumption() + qij_matrix_.memory_consumption();
+    statistics["HyperbolicModule - bounds"] = bounds_.memory_consumption();
+    statistics["HyperbolicModule - alpha, r, sources"] =
+        alpha_.memory_consumption() + r_.memory_consumption() +
+        source_.memory_consumption() + source_r_.memory_consumption();
+  }
+
 } /* namespace ryujin */
@@ -0,0 +1,155 @@
+//
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2020 - 2023 by the ryujin authors
+//
+
+#pragma once
+
+#include <deal.II/base/config.h>
+
+#include <string>
+
+namespace ryujin
+{
+  /**
+   * An enum describing the SIMD instruction set levels we distinguish in
+   * ryujin. The ordering is significant: a higher level implies support
+   * for all lower levels.
+   *
+   * @ingroup SIMD
+   */
+  enum class InstructionSet {
+    /**
+     * No (known) SIMD extension, scalar code paths only.
+     */
+    generic = 0,
+
+    /**
+     * SSE2, 128 bit registers: VectorizedArray<double>::size() == 2.
+     */
+    sse2 = 1,
+
+    /**
+     * AVX, 256 bit registers: VectorizedArray<double>::size() == 4.
+     */
+    avx = 2,
+
+    /**
+     * AVX2 with FMA, 256 bit registers.
+     */
+    avx2 = 3,
+
+    /**
+     * AVX-512 foundation, 512 bit registers:
+     * VectorizedArray<double>::size() == 8.
+     */
+    avx512 = 4,
+  };
+
+
+  /**
+   * Return a human readable name for the instruction set @p isa.
+   *
+   * @ingroup SIMD
+   */
+  inline std::string to_string(const InstructionSet isa)
+  {
+    switch (isa) {
+    case InstructionSet::avx512:
+      return "avx512";
+    case InstructionSet::avx2:
+      return "avx2";
+    case InstructionSet::avx:
+      return "avx";
+    case InstructionSet::sse2:
+      return "sse2";
+    case InstructionSet::generic:
+      break;
+    }
+    return "generic";
+  }
+
+
+  /**
+   * Return the instruction set the compute kernels were compiled for.
+   *
+   * The level is derived from the vectorization width deal.II was
+   * configured with (DEAL_II_VECTORIZATION_WIDTH_IN_BITS). This width
+   * fixes the SIMD width of dealii::VectorizedArray in all compute
+   * kernels and in the deal.II library, and therefore also the stride
+   * used by SparsityPatternSIMD and
+   * DoFRenumbering::export_indices_first(). deal.II refuses to compile
+   * translation units with a narrower instruction set than it was
+   * configured for, so the width is the same for every translation unit.
+   * The only refinement taken from the compiler flags is AVX2 with FMA,
+   * which deal.II does not distinguish from AVX.
+   *
+   * @ingroup SIMD
+   */
+  constexpr InstructionSet compiled_instruction_set()
+  {
+#if DEAL_II_VECTORIZATION_WIDTH_IN_BITS >= 512
+    return InstructionSet::avx512;
+#elif DEAL_II_VECTORIZATION_WIDTH_IN_BITS >= 256
+#if defined(__AVX2__) && defined(__FMA__)
+    return InstructionSet::avx2;
+#else
+    return InstructionSet::avx;
+#endif
+#elif DEAL_II_VECTORIZATION_WIDTH_IN_BITS >= 128 && defined(DEAL_II_HAVE_SSE2)
+    return InstructionSet::sse2;
+#else
+    return InstructionSet::generic;
+#endif
+  }
+
+
+  /**
+   * Query the CPU we are currently running on and return the highest
+   * instruction set level it supports.
+   *
+   * @note This function only executes instructions available on every
+   * x86-64 CPU, so it can be called early in main() to detect a binary
+   * that was compiled for an instruction set the host does not support.
+   * This is a best effort check: The compiler is free to use wide
+   * instructions in code that runs before the check (for example during
+   * static initialization or MPI setup), which would still fail with
+   * SIGILL.
+   *
+   * @ingroup SIMD
+   */
+  inline InstructionSet detect_instruction_set()
+  {
+#if (defined(__GNUC__) || defined(__clang__)) &&                               \
+    (defined(__x86_64__) || defined(__i386__))
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+      return InstructionSet::avx512;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+      return InstructionSet::avx2;
+    if (__builtin_cpu_supports("avx"))
+      return InstructionSet::avx;
+    if (__builtin_cpu_supports("sse2"))
+      return InstructionSet::sse2;
+    return InstructionSet::generic;
+#else
+    /*
+     * On non-x86 platforms we have no portable way to query vector
+     * extensions. Simply report what we have been compiled for.
+     */
+    return compiled_instruction_set();
+#endif
+  }
+
+
+  /**
+   * Return true if the host CPU supports the instruction set the binary
+   * was compiled for.
+   *
+   * @ingroup SIMD
+   */
+  inline bool instruction_set_supported()
+  {
+    return detect_instruction_set() >= compiled_instruction_set();
+  }
+} // namespace ryujin
@@ -0,0 +1,215 @@
+//
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2020 - 2023 by the ryujin authors
+//
+
+#pragma once
+
+#include <compile_time_options.h>
+
+#include "openmp.h"
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace ryujin
+{
+  /**
+   * Records per-thread busy and barrier wait times of thread-parallel
+   * loops in order to quantify the load imbalance among the OpenMP
+   * threads of an MPI rank.
+   *
+   * Intended use within a persistent parallel region:
+   * ```
+   * // serial context:
+   * auto data = load_imbalance().section("my section");
+   *
+   * RYUJIN_PARALLEL_REGION_BEGIN
+   * load_imbalance().begin(data);
+   *
+   * RYUJIN_OMP_FOR_NOWAIT
+   * for (...) {
+   * }
+   *
+   * load_imbalance().arrive(data);
+   * RYUJIN_OMP_BARRIER
+   * load_imbalance().depart(data);
+   * RYUJIN_PARALLEL_REGION_END
+   * ```
+   * The time a thread spends between begin() and arrive() is accounted
+   * as busy time, the time between arrive() and depart() as wait time.
+   * The class never synchronizes threads itself: the barrier is part of
+   * the instrumented code. If the class is disabled section() returns a
+   * null pointer and begin(), arrive() and depart() are no-ops.
+   *
+   * @ingroup Miscellaneous
+   */
+  class LoadImbalance
+  {
+  public:
+    using clock = std::chrono::steady_clock;
+
+    /**
+     * Accumulated times of a single thread. Padded to a cache line to
+     * avoid false sharing.
+     */
+    struct alignas(64) ThreadData {
+      double busy_time = 0.;
+      double wait_time = 0.;
+      clock::time_point start;
+      clock::time_point arrival;
+    };
+
+    using Data = std::vector<ThreadData>;
+
+    LoadImbalance()
+        : enabled_(false)
+    {
+    }
+
+    /**
+     * Enable or disable the collection of timings. Disabling also
+     * resets all accumulated data.
+     */
+    void enable(const bool enabled)
+    {
+      enabled_ = enabled;
+      if (!enabled_)
+        data_.clear();
+    }
+
+    /**
+     * Return true if timings are collected.
+     */
+    bool enabled() const
+    {
+      return enabled_;
+    }
+
+    /**
+     * Return a pointer to the (per thread) data of @p section, or a null
+     * pointer if the class is disabled. Must be called from a serial
+     * context.
+     */
+    Data *section(const std::string &section)
+    {
+      if (!enabled_)
+        return nullptr;
+
+      auto &data = data_[section];
+#ifdef WITH_OPENMP
+      const auto n_threads = static_cast<unsigned int>(omp_get_max_threads());
+#else
+      const auto n_threads = 1u;
+#endif
+      if (data.size() < n_threads)
+        data.resize(n_threads);
+      return &data;
+    }
+
+    /**
+     * Record the start of a thread-parallel loop on the calling thread.
+     */
+    static void begin(Data *data)
+    {
+      if (data == nullptr)
+        return;
+      thread_data(*data).start = clock::now();
+    }
+
+    /**
+     * Record the end of the work of the calling thread without
+     * synchronizing threads.
+     */
+    static void arrive(Data *data)
+    {
+      if (data == nullptr)
+        return;
+      auto &thread = thread_data(*data);
+      thread.arrival = clock::now();
+      thread.busy_time +=
+          std::chrono::duration<double>(thread.arrival - thread.start).count();
+    }
+
+    /**
+     * Record that the calling thread left the barrier following arrive()
+     * and account the time spent waiting in the barrier.
+     */
+    static void depart(Data *data)
+    {
+      if (data == nullptr)
+        return;
+      auto &thread = thread_data(*data);
+      thread.wait_time +=
+          std::chrono::duration<double>(clock::now() - thread.arrival).count();
+    }
+
+    /**
+     * Return the ratio of maximal over mean busy time of all threads of
+     * @p section, or 0 if no data has been recorded.
+     */
+    double imbalance(const std::string &section) const
+    {
+      const auto it = data_.find(section);
+      if (it == data_.end() || it->second.empty())
+        return 0.;
+
+      double max = 0.;
+      double sum = 0.;
+      for (const auto &thread : it->second) {
+        max = std::max(max, thread.busy_time);
+        sum += thread.busy_time;
+      }
+      const double mean = sum / it->second.size();
+      return mean > 0. ? max / mean : 0.;
+    }
+
+    /**
+     * Return the fraction of the total time (busy plus wait time, summed
+     * over all threads) of @p section that threads spent waiting in
+     * barriers, or 0 if no data has been recorded.
+     */
+    double wait_fraction(const std::string &section) const
+    {
+      const auto it = data_.find(section);
+      if (it == data_.end())
+        return 0.;
+
+      double busy = 0.;
+      double wait = 0.;
+      for (const auto &thread : it->second) {
+        busy += thread.busy_time;
+        wait += thread.wait_time;
+      }
+      return busy + wait > 0. ? wait / (busy + wait) : 0.;
+    }
+
+  private:
+    static ThreadData &thread_data(Data &data)
+    {
+#ifdef WITH_OPENMP
+      return data[omp_get_thread_num()];
+#else
+      return data[0];
+#endif
+    }
+
+    bool enabled_;
+    std::map<std::string, Data> data_;
+  };
+
+
+  /**
+   * Return a reference to the global LoadImbalance object.
+   *
+   * @ingroup Miscellaneous
+   */
+  inline LoadImbalance &load_imbalance()
+  {
+    static LoadImbalance load_imbalance;
+    return load_imbalance;
+  }
+} // namespace ryujin
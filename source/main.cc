@@ -6,6 +6,7 @@
 #include <compile_time_options.h>
 
 #include "equation_dispatch.h"
+#include "instruction_set.h"
 #include "introspection.h"
 
 #include <deal.II/base/mpi.h>
@@ -18,6 +19,8 @@
 
 #include <filesystem>
 #include <fstream>
+#include <string>
+#include <vector>
 
 /**
  * Change rounding mode on X86-64 architecture: Denormals are flushed to
@@ -54,6 +57,49 @@ void set_thread_limit()
 }
 
 
+/**
+ * Check that the host CPU supports the SIMD instruction set the compute
+ * kernels have been compiled for. The function returns false (and prints
+ * an error message) if at least one MPI rank runs on a CPU that lacks
+ * the required instruction set. If the instruction set of the build and
+ * of the host CPU differ otherwise, an informative line is printed on
+ * rank 0. (We do not print the line for a matching build because its
+ * content depends on the host and would end up in the output of all
+ * validation tests.) The compiled and detected instruction sets are
+ * always recorded in the log file, see TimeLoop.
+ */
+bool check_instruction_set(const MPI_Comm &mpi_communicator)
+{
+  const auto compiled = ryujin::compiled_instruction_set();
+  const auto detected = ryujin::detect_instruction_set();
+
+  const bool supported = ryujin::instruction_set_supported();
+  const bool all_supported =
+      !dealii::Utilities::MPI::logical_or(!supported, mpi_communicator);
+
+  if (!supported) {
+    std::cout << "[ERROR] Rank "
+              << dealii::Utilities::MPI::this_mpi_process(mpi_communicator)
+              << ": ryujin was compiled for the »"
+              << ryujin::to_string(compiled)
+              << "« instruction set but the host CPU only supports »"
+              << ryujin::to_string(detected)
+              << "«. Please use a build configured for this cluster "
+                 "partition."
+              << std::endl;
+  }
+
+  if (dealii::Utilities::MPI::this_mpi_process(mpi_communicator) == 0 &&
+      all_supported && detected != compiled)
+    std::cout << "[INFO] SIMD instruction set: " << ryujin::to_string(compiled)
+              << " (SIMD width " << dealii::VectorizedArray<NUMBER>::size()
+              << "), host CPU supports " << ryujin::to_string(detected)
+              << std::endl;
+
+  return all_supported;
+}
+
+
 /**
  * The main function
  */
@@ -69,6 +115,12 @@ int main(int argc, char *argv[])
 
   LIKWID_INIT;
 
+  if (!check_instruction_set(mpi_communicator)) {
+    LIKWID_CLOSE;
+    LSAN_DISABLE;
+    return 1;
+  }
+
   if (dealii::Utilities::MPI::this_mpi_process(mpi_communicator) == 0) {
 #ifndef WITH_OPENMP
     std::cout << "[INFO] OpenMP support disabled, set thread limit to one"
@@ -77,35 +129,33 @@ int main(int argc, char *argv[])
     std::cout << "[INFO] initiating flux capacitor" << std::endl;
   }
 
-  if (argc > 2) {
-    if (dealii::Utilities::MPI::this_mpi_process(mpi_communicator) == 0) {
-      std::cout << "[ERROR] Invalid number of parameters. At most one argument "
-                << "supported which has to be a parameter file." << std::endl;
-    }
-
-    LIKWID_CLOSE;
-    LSAN_DISABLE;
-    return 1;
-  }
+  /*
+   * More than one parameter file runs all parameter files in sequence
+   * (batch mode), see EquationDispatch::run().
+   */
 
   const auto executable_name = std::filesystem::path(argv[0]).filename();
-  std::string parameter_file = executable_name.string() + ".prm";
+  std::vector<std::string> parameter_files{executable_name.string() + ".prm"};
 
-  if (argc == 2) {
-    parameter_file = argv[1];
+  if (argc >= 2) {
+    parameter_files.assign(argv + 1, argv + argc);
 
-    if (!std::filesystem::exists(parameter_file)) {
-      if (dealii::Utilities::MPI::this_mpi_process(mpi_communicator) == 0) {
-        std::cout << "[ERROR] The specified parameter file »" << parameter_file
-                  << "« does not exist." << std::endl;
-      }
+    for (const auto &parameter_file : parameter_files) {
+      if (!std::filesystem::exists(parameter_file)) {
+        if (dealii::Utilities::MPI::this_mpi_process(mpi_communicator) == 0) {
+          std::cout << "[ERROR] The specified parameter file »"
+                    << parameter_file << "« does not exist." << std::endl;
+        }
 
-      LIKWID_CLOSE;
-      LSAN_DISABLE;
-      return 1;
+        LIKWID_CLOSE;
+        LSAN_DISABLE;
+        return 1;
+      }
     }
   }
 
+  const auto &parameter_file = parameter_files.front();
+
   if (!std::filesystem::exists(parameter_file)) {
     if (dealii::Utilities::MPI::this_mpi_process(mpi_communicator) == 0) {
       std::cout //
@@ -122,7 +172,7 @@ int main(int argc, char *argv[])
 
   {
     ryujin::EquationDispatch equation_dispatch;
-    equation_dispatch.run(parameter_file, mpi_communicator);
+    equation_dispatch.run(parameter_files, mpi_communicator);
   }
 
   LIKWID_CLOSE;
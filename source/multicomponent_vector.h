@@ -154,13 +154,19 @@ namespace ryujin
      * and updates the values of the @p n_comp component vectors at indices
      * i, i+1, ..., i+simd_length_1. with the values supplied by @p tensor.
      *
+     * If @p do_streaming_store is set to true, the vectorized variant
+     * writes the values with non-temporal (streaming) store instructions,
+     * see WritePolicy. The flag is ignored for non-vectorized access.
+     *
      * @note @p tensor can be an arbitrary indexable container, such as
      * dealii::Tensor or std::array, that has an `operator[]()` returning a @p
      * Number, and has a type trait `value_type`.
      */
     template <typename Number2 = Number,
               typename Tensor = dealii::Tensor<1, n_comp, Number2>>
-    void write_tensor(const Tensor &tensor, const unsigned int i);
+    void write_tensor(const Tensor &tensor,
+                      const unsigned int i,
+                      const bool do_streaming_store = false);
   };
 
 
@@ -309,7 +315,9 @@ namespace ryujin
   template <typename Number2, typename Tensor>
   DEAL_II_ALWAYS_INLINE inline void
   MultiComponentVector<Number, n_comp, simd_length>::write_tensor(
-      const Tensor &tensor, const unsigned int i)
+      const Tensor &tensor,
+      const unsigned int i,
+      const bool do_streaming_store)
   {
     static_assert(std::is_same<Number2, typename Tensor::value_type>::value,
                   "dummy type mismatch");
@@ -331,8 +339,25 @@ namespace ryujin
       for (unsigned int k = 0; k < VectorizedArray::size(); ++k)
         indices[k] = k * n_comp;
 
-      dealii::vectorized_transpose_and_store(
-          false, n_comp, &tensor[0], indices, this->begin() + i * n_comp);
+      if (do_streaming_store) {
+        /*
+         * The n_comp * simd_length values are stored contiguously
+         * starting at index i * n_comp. Transpose into a local buffer
+         * first and write the buffer with aligned streaming stores.
+         */
+        VectorizedArray buffer[n_comp];
+        dealii::vectorized_transpose_and_store(false,
+                                               n_comp,
+                                               &tensor[0],
+                                               indices,
+                                               &buffer[0][0]);
+        for (unsigned int d = 0; d < n_comp; ++d)
+          buffer[d].streaming_store(this->begin() + i * n_comp +
+                                    d * VectorizedArray::size());
+      } else {
+        dealii::vectorized_transpose_and_store(
+            false, n_comp, &tensor[0], indices, this->begin() + i * n_comp);
+      }
 
     } else {
       /* not implemented */
@@ -11,6 +11,39 @@ namespace ryujin
   namespace NavierStokes
   {
     template class ParabolicSolver<Description, DIM, NUMBER>;
+
+    template void
+    ParabolicSolver<Description, DIM, NUMBER>::backward_euler_step<0>(
+        const vector_type &,
+        const NUMBER,
+        std::array<std::reference_wrapper<const vector_type>, 0>,
+        const std::array<NUMBER, 0>,
+        vector_type &,
+        NUMBER,
+        unsigned int,
+        unsigned int) const;
+
+    template void
+    ParabolicSolver<Description, DIM, NUMBER>::backward_euler_step<1>(
+        const vector_type &,
+        const NUMBER,
+        std::array<std::reference_wrapper<const vector_type>, 1>,
+        const std::array<NUMBER, 1>,
+        vector_type &,
+        NUMBER,
+        unsigned int,
+        unsigned int) const;
+
+    template void
+    ParabolicSolver<Description, DIM, NUMBER>::backward_euler_step<2>(
+        const vector_type &,
+        const NUMBER,
+        std::array<std::reference_wrapper<const vector_type>, 2>,
+        const std::array<NUMBER, 2>,
+        vector_type &,
+        NUMBER,
+        unsigned int,
+        unsigned int) const;
   }
 } // namespace ryujin
 
@@ -10,6 +10,7 @@
 #include <convenience_macros.h>
 #include <initial_values.h>
 #include <offline_data.h>
+#include <patterns_conversion.h>
 #include <simd.h>
 #include <sparse_matrix_simd.h>
 
@@ -27,6 +28,8 @@
 #include <deal.II/multigrid/mg_smoother.h>
 #include <deal.II/multigrid/mg_transfer_matrix_free.h>
 
+#include <map>
+
 namespace ryujin
 {
   namespace NavierStokes
@@ -34,6 +37,45 @@ namespace ryujin
     template <int, typename>
     class DiagonalMatrix;
 
+    /**
+     * Controls the coarse grid solver used in the velocity and internal
+     * energy multigrid hierarchies.
+     */
+    enum class CoarseGridSolver {
+      /**
+       * Apply the Chebyshev smoother of the coarsest level with a large
+       * number of eigenvalue estimation steps as coarse "solver".
+       */
+      chebyshev,
+
+      /**
+       * Assemble the operator on the coarsest level and apply a single
+       * algebraic multigrid V-cycle.
+       */
+      amg,
+
+      /**
+       * Assemble the operator on the coarsest level and solve with a
+       * sparse direct factorization.
+       */
+      direct,
+    };
+  } // namespace NavierStokes
+} // namespace ryujin
+
+#ifndef DOXYGEN
+DECLARE_ENUM(ryujin::NavierStokes::CoarseGridSolver,
+             LIST({ryujin::NavierStokes::CoarseGridSolver::chebyshev,
+                   "chebyshev"},
+                  {ryujin::NavierStokes::CoarseGridSolver::amg, "amg"},
+                  {ryujin::NavierStokes::CoarseGridSolver::direct, "direct"}));
+#endif
+
+namespace ryujin
+{
+  namespace NavierStokes
+  {
+
     /**
      * Minimum entropy guaranteeing second-order time stepping for the
      * parabolic limiting equation @cite ryujin-2021-2, Eq. 3.3:
@@ -167,6 +209,37 @@ namespace ryujin
                                Number tau,
                                unsigned int cycle) const;
 
+      /**
+       * Given a reference to a previous state vector @p old_U at time @p
+       * old_t and a time-step size @p tau perform an implicit backward
+       * Euler step (and store the result in @p new_U).
+       *
+       * The function takes an optional array of states @p stage_U together
+       * with an array of weights @p stage_weights to construct a modified
+       * high-order update
+       * \f{align}
+       *   U^{\text{new}} = U^{\text{old}} + \tau\,\Big(\big(1 - \sum_s
+       *   \omega_s\big)\,P(U^{\text{new}}) + \sum_s \omega_s\,P(U_s)\Big),
+       * \f}
+       * where \f$P\f$ denotes the parabolic operator. The stage
+       * contributions are evaluated explicitly, which requires the
+       * remaining implicit weight \f$1 - \sum_s \omega_s\f$ to be positive
+       *
+       * The index @p stage enumerates the implicit solves of one step of
+       * the time integrator and identifies the stage for the GMG refresh
+       * policy.
+       */
+      template <int stages>
+      void backward_euler_step(
+          const vector_type &old_U,
+          const Number old_t,
+          std::array<std::reference_wrapper<const vector_type>, stages> stage_U,
+          const std::array<Number, stages> stage_weights,
+          vector_type &new_U,
+          Number tau,
+          unsigned int stage,
+          unsigned int cycle) const;
+
       /**
        * Print a status line with solver statistics. This function is used
        * for constructing the status message displayed periodically in the
@@ -174,6 +247,20 @@ namespace ryujin
        */
       void print_solver_statistics(std::ostream &output) const;
 
+      /**
+       * Record the memory consumption (in bytes) of the MatrixFree
+       * objects, the solver vectors, and the multigrid level data in
+       * @p statistics.
+       */
+      void memory_statistics(
+          std::map<std::string, std::size_t> &statistics) const;
+
+      /**
+       * Reset the number of restarts and warnings, the average iteration
+       * counts and the number of multigrid rebuilds.
+       */
+      void reset_statistics() const;
+
       //@}
       /**
        * @name Accessors
@@ -186,6 +273,66 @@ namespace ryujin
       //@}
 
     private:
+      /**
+       * Perform a theta step: For theta = 1/2 this is the Crank-Nicolson
+       * step described above, for theta = 1 a backward Euler step.
+       *
+       * The implicit time-step size @p tau is the fraction @p weight of
+       * the step size of the time integrator. The GMG refresh policy
+       * scales its reference step size with theta * weight and keeps its
+       * reference iteration counts per @p stage.
+       */
+      void theta_step(const vector_type &old_U,
+                      const Number old_t,
+                      vector_type &new_U,
+                      Number tau,
+                      Number theta,
+                      Number weight,
+                      unsigned int stage) const;
+
+      /**
+       * Evaluate the parabolic operator on @p stage_U explicitly and add
+       * @p factor times the result to the momentum and total energy of
+       * @p U.
+       */
+      void add_explicit_residual(const vector_type &stage_U,
+                                 const Number factor,
+                                 vector_type &U) const;
+
+      /**
+       * Return true if the density or theta * tau changed by more than the
+       * refresh tolerance since the GMG level operators were last rebuilt.
+       * The value theta * tau is compared per stage, i.e., against the
+       * reference step size scaled by the theta * weight of the current
+       * stage. The different stage sizes of the IMEX schemes thus do not
+       * trigger a rebuild.
+       */
+      bool gmg_operators_outdated() const;
+
+      /**
+       * Interpolate the density to all levels of the multigrid
+       * hierarchies, i.e., to the polynomial degrees of the p-multigrid
+       * hierarchy (for higher order elements) and to the geometric
+       * levels.
+       */
+      void interpolate_level_densities() const;
+
+      /**
+       * Return the weights of a polynomial extrapolation of the stored
+       * solution history to time @p t. The k-th weight belongs to the
+       * history entry history_slots_[k]. An empty vector is returned if
+       * extrapolation is disabled or fewer than two entries are stored.
+       */
+      std::vector<Number> extrapolation_weights(const Number t) const;
+
+      /**
+       * Store the current contents of velocity_ and internal_energy_ as
+       * the solution at time @p t in the history. Entries with a time
+       * larger than or equal to @p t (for example from a rejected step)
+       * and the oldest entry beyond the extrapolation order are dropped.
+       */
+      void update_history(const Number t) const;
+
       /**
        * @name Run time options
        */
@@ -200,6 +347,8 @@ namespace ryujin
       Number tolerance_;
       bool tolerance_linfty_norm_;
 
+      unsigned int extrapolation_order_;
+
       unsigned int gmg_max_iter_vel_;
       unsigned int gmg_max_iter_en_;
       double gmg_smoother_range_vel_;
@@ -209,6 +358,9 @@ namespace ryujin
       unsigned int gmg_smoother_degree_;
       unsigned int gmg_smoother_n_cg_iter_;
       unsigned int gmg_min_level_;
+      CoarseGridSolver gmg_coarse_solver_;
+      double gmg_refresh_tolerance_;
+      double gmg_refresh_iteration_factor_;
 
       //@}
       /**
@@ -239,10 +391,29 @@ namespace ryujin
       mutable scalar_type internal_energy_;
       mutable scalar_type internal_energy_rhs_;
       mutable scalar_type density_;
+      mutable vector_type explicit_U_;
+
+      mutable std::vector<block_vector_type> velocity_history_;
+      mutable std::vector<scalar_type> internal_energy_history_;
+      mutable std::vector<Number> history_times_;
+      mutable std::vector<unsigned int> history_slots_;
 
       mutable Number tau_;
       mutable Number theta_;
 
+      mutable scalar_type gmg_reference_density_;
+      mutable Number gmg_reference_tau_;
+      mutable Number gmg_stage_factor_;
+      mutable unsigned int gmg_stage_;
+      mutable bool gmg_refresh_velocity_;
+      mutable bool gmg_refresh_energy_;
+      mutable std::map<unsigned int, unsigned int>
+          gmg_reference_iterations_vel_;
+      mutable std::map<unsigned int, unsigned int>
+          gmg_reference_iterations_en_;
+      mutable unsigned int n_gmg_rebuilds_velocity_;
+      mutable unsigned int n_gmg_rebuilds_energy_;
+
       mutable dealii::MGLevelObject<dealii::MatrixFree<dim, float>>
           level_matrix_free_;
       mutable dealii::MGConstrainedDoFs mg_constrained_dofs_;
@@ -256,6 +427,30 @@ namespace ryujin
       mutable dealii::MGLevelObject<EnergyMatrix<dim, float, Number>>
           level_energy_matrices_;
 
+      /* p-multigrid hierarchy, indexed by the polynomial degree: */
+
+      mutable dealii::MGLevelObject<dealii::MatrixFree<dim, float>>
+          p_level_matrix_free_;
+      mutable dealii::MGLevelObject<dealii::MGTwoLevelTransfer<
+          dim,
+          dealii::LinearAlgebra::distributed::Vector<float>>>
+          p_level_transfers_;
+      mutable dealii::MGLevelObject<
+          dealii::LinearAlgebra::distributed::Vector<float>>
+          p_level_density_;
+      mutable MGTransferPolynomial<
+          dim,
+          dealii::LinearAlgebra::distributed::BlockVector<float>>
+          p_transfer_velocity_;
+      mutable dealii::MGLevelObject<VelocityMatrix<dim, float, Number>>
+          p_level_velocity_matrices_;
+      mutable MGTransferPolynomial<
+          dim,
+          dealii::LinearAlgebra::distributed::Vector<float>>
+          p_transfer_energy_;
+      mutable dealii::MGLevelObject<EnergyMatrix<dim, float, Number>>
+          p_level_energy_matrices_;
+
       mutable dealii::mg::SmootherRelaxation<
           dealii::PreconditionChebyshev<
               VelocityMatrix<dim, float, Number>,
@@ -271,6 +466,31 @@ namespace ryujin
           dealii::LinearAlgebra::distributed::Vector<float>>
           mg_smoother_energy_;
 
+      mutable dealii::mg::SmootherRelaxation<
+          dealii::PreconditionChebyshev<
+              VelocityMatrix<dim, float, Number>,
+              dealii::LinearAlgebra::distributed::BlockVector<float>,
+              DiagonalMatrix<dim, float>>,
+          dealii::LinearAlgebra::distributed::BlockVector<float>>
+          p_smoother_velocity_;
+
+      mutable dealii::mg::SmootherRelaxation<
+          dealii::PreconditionChebyshev<
+              EnergyMatrix<dim, float, Number>,
+              dealii::LinearAlgebra::distributed::Vector<float>>,
+          dealii::LinearAlgebra::distributed::Vector<float>>
+          p_smoother_energy_;
+
+      mutable MGCoarseGridAssembled<
+          dim,
+          dealii::LinearAlgebra::distributed::BlockVector<float>>
+          mg_coarse_velocity_;
+
+      mutable MGCoarseGridAssembled<
+          dim,
+          dealii::LinearAlgebra::distributed::Vector<float>>
+          mg_coarse_energy_;
+
       //@}
     };
 
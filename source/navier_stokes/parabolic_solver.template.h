@@ -13,6 +13,7 @@
 #include <scope.h>
 #include <simd.h>
 
+#include <deal.II/base/memory_consumption.h>
 #include <deal.II/lac/linear_operator.h>
 #include <deal.II/lac/precondition.h>
 #include <deal.II/lac/solver_cg.h>
@@ -23,6 +24,7 @@
 #include <deal.II/multigrid/mg_transfer_matrix_free.h>
 #include <deal.II/multigrid/multigrid.h>
 
+#include <algorithm>
 #include <atomic>
 
 namespace ryujin
@@ -109,7 +111,34 @@ namespace ryujin
           "multigrid - min level",
           gmg_min_level_,
           "Minimal mesh level to be visited in the geometric multigrid "
-          "cycle where the coarse grid solver (Chebyshev) is called");
+          "cycle where the coarse grid solver is called");
+
+      gmg_coarse_solver_ = CoarseGridSolver::chebyshev;
+      add_parameter(
+          "multigrid - coarse solver",
+          gmg_coarse_solver_,
+          "Coarse grid solver on the minimal mesh level: chebyshev (apply "
+          "the Chebyshev smoother), amg (assemble the level operator and "
+          "apply an AMG V-cycle), direct (assemble the level operator and "
+          "use a sparse direct solver)");
+
+      gmg_refresh_tolerance_ = 0.05;
+      add_parameter(
+          "multigrid - refresh tolerance",
+          gmg_refresh_tolerance_,
+          "Rebuild the multigrid level operators and smoothers if the "
+          "density or theta * tau (of the same stage) changed by more "
+          "than this relative amount since the last rebuild. Set to 0 to "
+          "rebuild in every step");
+
+      gmg_refresh_iteration_factor_ = 1.5;
+      add_parameter(
+          "multigrid - refresh iteration factor",
+          gmg_refresh_iteration_factor_,
+          "Rebuild the multigrid level operators and smoothers if the "
+          "number of GMG iterations exceeds this factor times the number "
+          "of iterations of the first solve of the same stage after the "
+          "last rebuild");
 
       tolerance_ = Number(1.0e-12);
       add_parameter("tolerance", tolerance_, "Tolerance for linear solvers");
@@ -119,6 +148,14 @@ namespace ryujin
                     tolerance_linfty_norm_,
                     "Use the l_infty norm instead of the l_2 norm for the "
                     "stopping criterion");
+
+      extrapolation_order_ = 0;
+      add_parameter("extrapolation order",
+                    extrapolation_order_,
+                    "Polynomial degree of the extrapolation of previously "
+                    "computed velocities and internal energies that is used "
+                    "as initial guess for the linear solvers. Set to 0 to "
+                    "start from the old state instead");
     }
 
 
@@ -156,25 +193,69 @@ namespace ryujin
 
       density_.reinit(scalar_partitioner);
 
+      explicit_U_.reinit(offline_data_->vector_partitioner());
+
+      /*
+       * Extrapolation of initial guesses: A polynomial of degree k needs
+       * k + 1 stored solutions.
+       */
+
+      const unsigned int n_slots =
+          extrapolation_order_ > 0 ? extrapolation_order_ + 1 : 0;
+      velocity_history_.resize(n_slots);
+      internal_energy_history_.resize(n_slots);
+      for (unsigned int k = 0; k < n_slots; ++k) {
+        velocity_history_[k].reinit(dim);
+        for (unsigned int i = 0; i < dim; ++i)
+          velocity_history_[k].block(i).reinit(scalar_partitioner);
+        internal_energy_history_[k].reinit(scalar_partitioner);
+      }
+      history_times_.clear();
+      history_slots_.clear();
+
       /* Initialize multigrid: */
 
+      gmg_reference_tau_ = Number(0.);
+      gmg_stage_factor_ = Number(1.);
+      gmg_stage_ = 0;
+      gmg_refresh_velocity_ = true;
+      gmg_refresh_energy_ = true;
+      gmg_reference_iterations_vel_.clear();
+      gmg_reference_iterations_en_.clear();
+      n_gmg_rebuilds_velocity_ = 0;
+      n_gmg_rebuilds_energy_ = 0;
+
       if (!use_gmg_velocity_ && !use_gmg_internal_energy_)
         return;
 
+      gmg_reference_density_.reinit(scalar_partitioner);
+
+#ifndef DEAL_II_WITH_TRILINOS
+      AssertThrow(gmg_coarse_solver_ == CoarseGridSolver::chebyshev,
+                  ExcMessage("The amg and direct multigrid coarse solvers "
+                             "require deal.II with Trilinos"));
+#endif
+
+      /*
+       * The geometric multigrid hierarchy is built on the level DoFHandler
+       * of OfflineData, which is the Q1 space at the bottom of the
+       * p-multigrid hierarchy for higher order elements:
+       */
+      const auto &level_dof_handler = offline_data_->level_dof_handler();
+
       const unsigned int n_levels =
-          offline_data_->dof_handler().get_triangulation().n_global_levels();
+          level_dof_handler.get_triangulation().n_global_levels();
       const unsigned int min_level = std::min(gmg_min_level_, n_levels - 1);
       MGLevelObject<IndexSet> relevant_sets(0, n_levels - 1);
       for (unsigned int level = 0; level < n_levels; ++level)
         dealii::DoFTools::extract_locally_relevant_level_dofs(
-            offline_data_->dof_handler(), level, relevant_sets[level]);
-      mg_constrained_dofs_.initialize(offline_data_->dof_handler(),
-                                      relevant_sets);
+            level_dof_handler, level, relevant_sets[level]);
+      mg_constrained_dofs_.initialize(level_dof_handler, relevant_sets);
       std::set<types::boundary_id> boundary_ids;
       boundary_ids.insert(Boundary::dirichlet);
       boundary_ids.insert(Boundary::no_slip);
-      mg_constrained_dofs_.make_zero_boundary_constraints(
-          offline_data_->dof_handler(), boundary_ids);
+      mg_constrained_dofs_.make_zero_boundary_constraints(level_dof_handler,
+                                                          boundary_ids);
 
       typename MatrixFree<dim, float>::AdditionalData additional_data_level;
       additional_data_level.tasks_parallel_scheme =
@@ -186,22 +267,60 @@ namespace ryujin
         additional_data_level.mg_level = level;
         AffineConstraints<double> constraints(relevant_sets[level]);
         // constraints.add_lines(mg_constrained_dofs_.get_boundary_indices(level));
-        // constraints.merge(mg_constrained_dofs_.get_level_constraints(level));
+        constraints.merge(offline_data_->level_affine_constraints()[level]);
         constraints.close();
         level_matrix_free_[level].reinit(
             offline_data_->discretization().mapping(),
-            offline_data_->dof_handler(),
+            level_dof_handler,
             constraints,
             offline_data_->discretization().quadrature_1d(),
             additional_data_level);
         level_matrix_free_[level].initialize_dof_vector(level_density_[level]);
       }
 
-      mg_transfer_velocity_.build(offline_data_->dof_handler(),
-                                  mg_constrained_dofs_,
-                                  level_matrix_free_);
-      mg_transfer_energy_.build(offline_data_->dof_handler(),
-                                level_matrix_free_);
+      mg_transfer_velocity_.build(
+          level_dof_handler, mg_constrained_dofs_, level_matrix_free_);
+      mg_transfer_energy_.build(level_dof_handler, level_matrix_free_);
+
+      /*
+       * p-multigrid: For higher order elements we coarsen from the
+       * polynomial degree of the finite element down to degree 1 on the
+       * active mesh before descending the geometric hierarchy.
+       */
+
+      constexpr auto order = Discretization<dim>::order_finite_element;
+      if constexpr (order > 1) {
+        typename MatrixFree<dim, float>::AdditionalData additional_data_p;
+        additional_data_p.tasks_parallel_scheme =
+            MatrixFree<dim, float>::AdditionalData::none;
+
+        const auto &p_level_constraints =
+            offline_data_->p_level_affine_constraints();
+
+        p_level_matrix_free_.resize(1, order);
+        p_level_density_.resize(1, order);
+        p_level_transfers_.resize(1, order);
+        for (unsigned int degree = 1; degree <= order; ++degree) {
+          p_level_matrix_free_[degree].reinit(
+              offline_data_->discretization().mapping(),
+              offline_data_->p_level_dof_handler(degree),
+              p_level_constraints[degree],
+              offline_data_->discretization().quadrature_1d(),
+              additional_data_p);
+          p_level_matrix_free_[degree].initialize_dof_vector(
+              p_level_density_[degree]);
+
+          if (degree > 1)
+            p_level_transfers_[degree].reinit_polynomial_transfer(
+                offline_data_->p_level_dof_handler(degree),
+                offline_data_->p_level_dof_handler(degree - 1),
+                p_level_constraints[degree],
+                p_level_constraints[degree - 1]);
+        }
+
+        p_transfer_velocity_.build(p_level_transfers_, p_level_matrix_free_);
+        p_transfer_energy_.build(p_level_transfers_, p_level_matrix_free_);
+      }
     }
 
     template <typename Description, int dim, typename Number>
@@ -210,10 +329,75 @@ namespace ryujin
         const Number t,
         vector_type &new_U,
         Number tau,
-        unsigned int cycle) const
+        unsigned int /*cycle*/) const
+    {
+      theta_step(old_U, t, new_U, tau, Number(0.5), Number(1.), 0);
+    }
+
+
+    template <typename Description, int dim, typename Number>
+    template <int stages>
+    void ParabolicSolver<Description, dim, Number>::backward_euler_step(
+        const vector_type &old_U,
+        const Number t,
+        std::array<std::reference_wrapper<const vector_type>, stages> stage_U,
+        const std::array<Number, stages> stage_weights,
+        vector_type &new_U,
+        Number tau,
+        unsigned int stage,
+        unsigned int /*cycle*/) const
+    {
+      if constexpr (stages == 0) {
+        theta_step(old_U, t, new_U, tau, Number(1.), Number(1.), stage);
+
+      } else {
+
+        /*
+         * Add the explicit contributions tau * w_j * P(U_j) of all stages
+         * to the old state and perform a backward Euler step with the
+         * remaining weight (1 - sum_j w_j) * tau:
+         */
+
+        explicit_U_ = old_U;
+        Number weight = Number(1.);
+        for (unsigned int s = 0; s < stages; ++s) {
+          add_explicit_residual(
+              stage_U[s].get(), stage_weights[s] * tau, explicit_U_);
+          weight -= stage_weights[s];
+        }
+
+        Assert(weight > Number(0.),
+               dealii::ExcMessage("The weight of the implicit part of the "
+                                  "stage must be positive."));
+
+        /*
+         * Shift the time such that boundary values are evaluated at the
+         * end of the stage, t + tau:
+         */
+        const Number implicit_tau = weight * tau;
+        theta_step(explicit_U_,
+                   t + tau - implicit_tau,
+                   new_U,
+                   implicit_tau,
+                   Number(1.),
+                   weight,
+                   stage);
+      }
+    }
+
+
+    template <typename Description, int dim, typename Number>
+    void ParabolicSolver<Description, dim, Number>::theta_step(
+        const vector_type &old_U,
+        const Number t,
+        vector_type &new_U,
+        Number tau,
+        Number theta,
+        Number weight,
+        unsigned int stage) const
     {
 #ifdef DEBUG_OUTPUT
-      std::cout << "ParabolicSolver<dim, Number>::step()" << std::endl;
+      std::cout << "ParabolicSolver<dim, Number>::theta_step()" << std::endl;
 #endif
 
       CALLGRIND_START_INSTRUMENTATION
@@ -229,8 +413,14 @@ namespace ryujin
       const unsigned int n_owned = offline_data_->n_locally_owned();
       const unsigned int size_regular = n_owned / simd_length * simd_length;
 
+      /* Polynomial degree of the finest level of the p-multigrid: */
+      constexpr auto order = Discretization<dim>::order_finite_element;
+
       DiagonalMatrix<dim, Number> diagonal_matrix;
 
+      /* Set if the level densities have been interpolated in this step: */
+      bool level_density_updated = false;
+
       /*
        * Set time step size and record the time t_{n+1/2} for the computed
        * velocity.
@@ -240,20 +430,38 @@ namespace ryujin
        */
 
       tau_ = tau;
-      theta_ = Number(0.5);
+      theta_ = theta;
+      gmg_stage_factor_ = theta * weight;
+      gmg_stage_ = stage;
 #ifdef DEBUG_OUTPUT
       std::cout << "        perform time-step with tau = " << tau << std::endl;
 #endif
 
+      /* Extrapolation weights for the initial guesses at t + theta tau: */
+      const auto weights = extrapolation_weights(t + theta_ * tau_);
+
       /*
        * Step 1:
        *
        * Build right hand side for the velocity update.
        * Also initialize solution vectors for internal energy and velocity
-       * update.
+       * update, and the diagonal preconditioner in the same sweep.
        */
       {
         Scope scope(computing_timer_, "time step [P] 1 - update velocities");
+
+        auto &diagonal = diagonal_matrix.get_vector();
+        diagonal.reinit(density_, true);
+
+        /*
+         * If available, use a polynomial extrapolation of previously
+         * computed velocities as initial guess. The boundary conditions
+         * below are applied to the extrapolated velocity as well.
+         */
+        std::vector<const block_vector_type *> history;
+        for (unsigned int k = 0; k < weights.size(); ++k)
+          history.push_back(&velocity_history_[history_slots_[k]]);
+
         RYUJIN_PARALLEL_REGION_BEGIN
         LIKWID_MARKER_START("time_step_parabolic_1");
 
@@ -267,9 +475,13 @@ namespace ryujin
           const auto m_i = load_value<VA>(lumped_mass_matrix, i);
 
           store_value<VA>(density_, rho_i, i);
+          store_value<VA>(diagonal, VA(1.) / (rho_i * m_i), i);
           /* (5.4a) */
           for (unsigned int d = 0; d < dim; ++d) {
-            store_value<VA>(velocity_.block(d), M_i[d] / rho_i, i);
+            auto V_i = history.empty() ? VA(M_i[d] / rho_i) : VA(0.);
+            for (unsigned int k = 0; k < history.size(); ++k)
+              V_i += weights[k] * load_value<VA>(history[k]->block(d), i);
+            store_value<VA>(velocity_.block(d), V_i, i);
             store_value<VA>(velocity_rhs_.block(d), m_i * (M_i[d]), i);
           }
           store_value<VA>(internal_energy_, rho_e_i / rho_i, i);
@@ -286,9 +498,13 @@ namespace ryujin
           const auto m_i = lumped_mass_matrix.local_element(i);
 
           density_.local_element(i) = rho_i;
+          diagonal.local_element(i) = Number(1.) / (rho_i * m_i);
           /* (5.4a) */
           for (unsigned int d = 0; d < dim; ++d) {
-            velocity_.block(d).local_element(i) = M_i[d] / rho_i;
+            auto V_i = history.empty() ? M_i[d] / rho_i : Number(0.);
+            for (unsigned int k = 0; k < history.size(); ++k)
+              V_i += weights[k] * history[k]->block(d).local_element(i);
+            velocity_.block(d).local_element(i) = V_i;
             velocity_rhs_.block(d).local_element(i) = m_i * M_i[d];
           }
           internal_energy_.local_element(i) = rho_e_i / rho_i;
@@ -362,23 +578,34 @@ namespace ryujin
          */
 
         affine_constraints.set_zero(density_);
+        affine_constraints.set_zero(diagonal);
         affine_constraints.set_zero(internal_energy_);
         for (unsigned int d = 0; d < dim; ++d) {
           affine_constraints.set_zero(velocity_.block(d));
           affine_constraints.set_zero(velocity_rhs_.block(d));
         }
 
-        /* Prepare preconditioner: */
-
-        diagonal_matrix.reinit(
-            lumped_mass_matrix, density_, affine_constraints);
-
         /*
-         * Update MG matrices all 4 time steps; this is a balance because more
-         * refreshes will render the approximation better, at some additional
-         * cost.
+         * Rebuild the MG level operators and smoothers only if they are
+         * likely outdated: This is the case if the density or theta * tau
+         * changed significantly since the last rebuild, or if the
+         * iteration count of the last GMG solve increased noticeably (see
+         * Step 1 and Step 2 below).
+         *
+         * Both hierarchies are rebuilt together, and the density and step
+         * size of every rebuild are recorded as the new reference.
          */
-        if (use_gmg_velocity_ && (cycle % 4 == 1)) {
+        if (use_gmg_velocity_ || use_gmg_internal_energy_) {
+          if (gmg_refresh_velocity_ || gmg_refresh_energy_ ||
+              gmg_operators_outdated()) {
+            gmg_refresh_velocity_ = true;
+            gmg_refresh_energy_ = true;
+            gmg_reference_density_ = density_;
+            gmg_reference_tau_ = theta_ * tau_ / gmg_stage_factor_;
+          }
+        }
+
+        if (use_gmg_velocity_ && gmg_refresh_velocity_) {
           MGLevelObject<typename PreconditionChebyshev<
               VelocityMatrix<dim, float, Number>,
               LinearAlgebra::distributed::BlockVector<float>,
@@ -388,8 +615,8 @@ namespace ryujin
 
           level_velocity_matrices_.resize(level_matrix_free_.min_level(),
                                           level_matrix_free_.max_level());
-          mg_transfer_velocity_.interpolate_to_mg(
-              offline_data_->dof_handler(), level_density_, density_);
+          interpolate_level_densities();
+          level_density_updated = true;
 
           for (unsigned int level = level_matrix_free_.min_level();
                level <= level_matrix_free_.max_level();
@@ -403,7 +630,8 @@ namespace ryujin
                 level);
             level_velocity_matrices_[level].compute_diagonal(
                 smoother_data[level].preconditioner);
-            if (level == level_matrix_free_.min_level()) {
+            if (level == level_matrix_free_.min_level() &&
+                gmg_coarse_solver_ == CoarseGridSolver::chebyshev) {
               smoother_data[level].degree = numbers::invalid_unsigned_int;
               smoother_data[level].eig_cg_n_iterations = 500;
               smoother_data[level].smoothing_range = 1e-3;
@@ -418,6 +646,47 @@ namespace ryujin
           }
           mg_smoother_velocity_.initialize(level_velocity_matrices_,
                                            smoother_data);
+
+          if constexpr (order > 1) {
+            decltype(smoother_data) p_smoother_data(1, order);
+            p_level_velocity_matrices_.resize(1, order);
+            for (unsigned int degree = 1; degree <= order; ++degree) {
+              p_level_velocity_matrices_[degree].initialize(
+                  *parabolic_system_,
+                  *offline_data_,
+                  p_level_matrix_free_[degree],
+                  p_level_density_[degree],
+                  theta_ * tau_,
+                  degree,
+                  /* p_level */ true);
+              p_level_velocity_matrices_[degree].compute_diagonal(
+                  p_smoother_data[degree].preconditioner);
+              p_smoother_data[degree].degree = gmg_smoother_degree_;
+              p_smoother_data[degree].eig_cg_n_iterations =
+                  gmg_smoother_n_cg_iter_;
+              p_smoother_data[degree].smoothing_range = gmg_smoother_range_vel_;
+              if (gmg_smoother_n_cg_iter_ == 0)
+                p_smoother_data[degree].max_eigenvalue =
+                    gmg_smoother_max_eig_vel_;
+            }
+            p_smoother_velocity_.initialize(p_level_velocity_matrices_,
+                                            p_smoother_data);
+          }
+
+          if (gmg_coarse_solver_ != CoarseGridSolver::chebyshev) {
+            const auto min_level = level_matrix_free_.min_level();
+            mg_coarse_velocity_.initialize(
+                *parabolic_system_,
+                *offline_data_,
+                level_density_[min_level],
+                theta_ * tau_,
+                min_level,
+                gmg_coarse_solver_ == CoarseGridSolver::direct);
+          }
+
+          gmg_refresh_velocity_ = false;
+          gmg_reference_iterations_vel_.clear();
+          n_gmg_rebuilds_velocity_++;
         }
 
         LIKWID_MARKER_STOP("time_step_parabolic_1");
@@ -461,8 +730,14 @@ namespace ryujin
 
           using bvt_float = LinearAlgebra::distributed::BlockVector<float>;
 
-          MGCoarseGridApplySmoother<bvt_float> mg_coarse;
-          mg_coarse.initialize(mg_smoother_velocity_);
+          MGCoarseGridApplySmoother<bvt_float> mg_coarse_smoother;
+          mg_coarse_smoother.initialize(mg_smoother_velocity_);
+
+          const MGCoarseGridBase<bvt_float> &mg_coarse =
+              gmg_coarse_solver_ == CoarseGridSolver::chebyshev
+                  ? static_cast<const MGCoarseGridBase<bvt_float> &>(
+                        mg_coarse_smoother)
+                  : mg_coarse_velocity_;
 
           mg::Matrix<bvt_float> mg_matrix(level_velocity_matrices_);
 
@@ -474,21 +749,63 @@ namespace ryujin
                                   level_velocity_matrices_.min_level(),
                                   level_velocity_matrices_.max_level());
 
-          const auto &dof_handler = offline_data_->dof_handler();
           PreconditionMG<dim, bvt_float, MGTransferVelocity<dim, float>>
-              preconditioner(dof_handler, mg, mg_transfer_velocity_);
+              preconditioner(offline_data_->level_dof_handler(),
+                             mg,
+                             mg_transfer_velocity_);
 
           SolverControl solver_control(gmg_max_iter_vel_, tolerance_velocity);
           SolverCG<block_vector_type> solver(solver_control);
-          solver.solve(
-              velocity_operator, velocity_, velocity_rhs_, preconditioner);
+
+          if constexpr (order > 1) {
+            /*
+             * p-multigrid: A V-cycle of the geometric multigrid on the Q1
+             * space serves as coarse solver of the polynomial levels:
+             */
+            MGCoarseGridApplyPreconditioner<bvt_float, decltype(preconditioner)>
+                p_coarse(preconditioner);
+            mg::Matrix<bvt_float> p_matrix(p_level_velocity_matrices_);
+            Multigrid<bvt_float> p_mg(p_matrix,
+                                      p_coarse,
+                                      p_transfer_velocity_,
+                                      p_smoother_velocity_,
+                                      p_smoother_velocity_,
+                                      1,
+                                      order);
+            PreconditionMG<dim,
+                           bvt_float,
+                           MGTransferPolynomial<dim, bvt_float>>
+                p_preconditioner(
+                    offline_data_->dof_handler(), p_mg, p_transfer_velocity_);
+            solver.solve(
+                velocity_operator, velocity_, velocity_rhs_, p_preconditioner);
+          } else {
+            solver.solve(
+                velocity_operator, velocity_, velocity_rhs_, preconditioner);
+          }
 
           /* update exponential moving average */
           n_iterations_velocity_ =
               0.9 * n_iterations_velocity_ + 0.1 * solver_control.last_step();
 
+          /*
+           * Request a rebuild if the iteration count increased compared
+           * to the first solve of the same stage after the last rebuild:
+           */
+          const auto n_iterations = solver_control.last_step();
+          const auto [it, inserted] =
+              gmg_reference_iterations_vel_.try_emplace(gmg_stage_,
+                                                        n_iterations);
+          if (!inserted &&
+              n_iterations >
+                  gmg_refresh_iteration_factor_ * std::max(it->second, 1u))
+            gmg_refresh_velocity_ = true;
+
         } catch (SolverControl::NoConvergence &) {
 
+          /* GMG did not converge, request a rebuild: */
+          gmg_refresh_velocity_ = use_gmg_velocity_;
+
           SolverControl solver_control(1000, tolerance_velocity);
           SolverCG<block_vector_type> solver(solver_control);
           solver.solve(
@@ -513,6 +830,29 @@ namespace ryujin
 
         LIKWID_MARKER_START("time_step_parabolic_2");
 
+        using VA = VectorizedArray<Number>;
+        constexpr auto simd_length = VA::size();
+
+        const auto &lumped_mass_matrix = offline_data_->lumped_mass_matrix();
+
+        /*
+         * For a backward Euler step (theta = 1) the kinetic energy
+         * decreases by 1/2 m_i rho_i |V_i^{n+1} - V_i^n|^2 in addition to
+         * the dissipation m_i K_i^{n+1}. We add this defect to the internal
+         * energy in order to conserve the total energy. For theta = 1/2
+         * the extrapolation in Step 3 is conservative by itself.
+         */
+        const bool add_defect = (theta_ == Number(1.));
+
+        /*
+         * The old internal energy is no longer needed once the right hand
+         * side is formed; if available, use a polynomial extrapolation of
+         * previously computed internal energies as initial guess:
+         */
+        std::vector<const scalar_type *> history;
+        for (unsigned int k = 0; k < weights.size(); ++k)
+          history.push_back(&internal_energy_history_[history_slots_[k]]);
+
         /* Compute m_i K_i^{n+1/2}:  (5.5) */
         matrix_free_.template cell_loop<scalar_type, block_vector_type>(
             [this](const auto &data,
@@ -561,38 +901,53 @@ namespace ryujin
             velocity_,
             /* zero destination */ true);
 
-        using VA = VectorizedArray<Number>;
-        constexpr auto simd_length = VA::size();
+        /*
+         * Form the right hand side m_i rho_i e_i + theta tau m_i K_i and
+         * the extrapolated initial guess in a single thread-parallel sweep:
+         */
+        const auto compute = [&](auto number, const unsigned int i) {
+          using T = decltype(number);
+          const auto rhs_i = load_value<T>(internal_energy_rhs_, i);
+          const auto m_i = load_value<T>(lumped_mass_matrix, i);
+          const auto rho_i = load_value<T>(density_, i);
+          const auto e_i = load_value<T>(internal_energy_, i);
+          /* rhs_i already contains m_i K_i^{n+1/2} */
+          auto result = m_i * rho_i * e_i + theta_ * tau_ * rhs_i;
+
+          if (add_defect) {
+            const auto U_i = old_U.template get_tensor<T>(i);
+            const auto view = hyperbolic_system_->template view<dim, T>();
+            const auto V_i = view.momentum(U_i) / view.density(U_i);
+            T defect = T(0.);
+            for (unsigned int d = 0; d < dim; ++d) {
+              const auto delta = load_value<T>(velocity_.block(d), i) - V_i[d];
+              defect += delta * delta;
+            }
+            result += Number(0.5) * m_i * rho_i * defect;
+          }
+
+          store_value<T>(internal_energy_rhs_, result, i);
+
+          if (!history.empty()) {
+            T e_new = T(0.);
+            for (unsigned int k = 0; k < history.size(); ++k)
+              e_new += weights[k] * load_value<T>(*history[k], i);
+            store_value<T>(internal_energy_, e_new, i);
+          }
+        };
 
-        const auto &lumped_mass_matrix = offline_data_->lumped_mass_matrix();
-        const unsigned int n_owned = offline_data_->n_locally_owned();
         const unsigned int size_regular = n_owned / simd_length * simd_length;
 
         RYUJIN_PARALLEL_REGION_BEGIN
 
         RYUJIN_OMP_FOR
-        for (unsigned int i = 0; i < size_regular; i += simd_length) {
-          const auto rhs_i = load_value<VA>(internal_energy_rhs_, i);
-          const auto m_i = load_value<VA>(lumped_mass_matrix, i);
-          const auto rho_i = load_value<VA>(density_, i);
-          const auto e_i = load_value<VA>(internal_energy_, i);
-          /* rhs_i already contains m_i K_i^{n+1/2} */
-          store_value<VA>(internal_energy_rhs_,
-                          m_i * rho_i * e_i + theta_ * tau_ * rhs_i,
-                          i);
-        }
+        for (unsigned int i = 0; i < size_regular; i += simd_length)
+          compute(VA(), i);
 
         RYUJIN_PARALLEL_REGION_END
 
-        for (unsigned int i = size_regular; i < n_owned; ++i) {
-          const auto rhs_i = internal_energy_rhs_.local_element(i);
-          const auto m_i = lumped_mass_matrix.local_element(i);
-          const auto rho_i = density_.local_element(i);
-          const auto e_i = internal_energy_.local_element(i);
-          /* rhs_i already contains m_i K_i^{n+1/2} */
-          internal_energy_rhs_.local_element(i) =
-              m_i * rho_i * e_i + theta_ * tau_ * rhs_i;
-        }
+        for (unsigned int i = size_regular; i < n_owned; ++i)
+          compute(Number(), i);
 
         /*
          * Set up "strongly enforced" boundary conditions that are not stored
@@ -619,6 +974,7 @@ namespace ryujin
             const auto rho_i = view.density(U_i);
             const auto e_i = view.internal_energy(U_i) / rho_i;
             internal_energy_rhs_.local_element(i) = e_i;
+            internal_energy_.local_element(i) = e_i;
           }
         }
 
@@ -628,14 +984,11 @@ namespace ryujin
          * the stencil - consequently we have to remove constrained dofs from
          * the linear system.
          */
+        affine_constraints.set_zero(internal_energy_);
         affine_constraints.set_zero(internal_energy_rhs_);
 
-        /*
-         * Update MG matrices all 4 time steps; this is a balance because more
-         * refreshes will render the approximation better, at some additional
-         * cost.
-         */
-        if (use_gmg_internal_energy_ && (cycle % 4 == 1)) {
+        /* Rebuild the MG level operators and smoothers, see Step 1: */
+        if (use_gmg_internal_energy_ && gmg_refresh_energy_) {
           MGLevelObject<typename PreconditionChebyshev<
               EnergyMatrix<dim, float, Number>,
               LinearAlgebra::distributed::Vector<float>>::AdditionalData>
@@ -644,6 +997,8 @@ namespace ryujin
 
           level_energy_matrices_.resize(level_matrix_free_.min_level(),
                                         level_matrix_free_.max_level());
+          if (!level_density_updated)
+            interpolate_level_densities();
 
           for (unsigned int level = level_matrix_free_.min_level();
                level <= level_matrix_free_.max_level();
@@ -656,7 +1011,8 @@ namespace ryujin
                 level);
             level_energy_matrices_[level].compute_diagonal(
                 smoother_data[level].preconditioner);
-            if (level == level_matrix_free_.min_level()) {
+            if (level == level_matrix_free_.min_level() &&
+                gmg_coarse_solver_ == CoarseGridSolver::chebyshev) {
               smoother_data[level].degree = numbers::invalid_unsigned_int;
               smoother_data[level].eig_cg_n_iterations = 500;
               smoother_data[level].smoothing_range = 1e-3;
@@ -670,6 +1026,46 @@ namespace ryujin
             }
           }
           mg_smoother_energy_.initialize(level_energy_matrices_, smoother_data);
+
+          if constexpr (order > 1) {
+            decltype(smoother_data) p_smoother_data(1, order);
+            p_level_energy_matrices_.resize(1, order);
+            for (unsigned int degree = 1; degree <= order; ++degree) {
+              p_level_energy_matrices_[degree].initialize(
+                  *offline_data_,
+                  p_level_matrix_free_[degree],
+                  p_level_density_[degree],
+                  theta_ * tau_ * parabolic_system_->cv_inverse_kappa(),
+                  degree,
+                  /* p_level */ true);
+              p_level_energy_matrices_[degree].compute_diagonal(
+                  p_smoother_data[degree].preconditioner);
+              p_smoother_data[degree].degree = gmg_smoother_degree_;
+              p_smoother_data[degree].eig_cg_n_iterations =
+                  gmg_smoother_n_cg_iter_;
+              p_smoother_data[degree].smoothing_range = gmg_smoother_range_en_;
+              if (gmg_smoother_n_cg_iter_ == 0)
+                p_smoother_data[degree].max_eigenvalue =
+                    gmg_smoother_max_eig_en_;
+            }
+            p_smoother_energy_.initialize(p_level_energy_matrices_,
+                                          p_smoother_data);
+          }
+
+          if (gmg_coarse_solver_ != CoarseGridSolver::chebyshev) {
+            const auto min_level = level_matrix_free_.min_level();
+            mg_coarse_energy_.initialize(
+                *parabolic_system_,
+                *offline_data_,
+                level_density_[min_level],
+                theta_ * tau_ * parabolic_system_->cv_inverse_kappa(),
+                min_level,
+                gmg_coarse_solver_ == CoarseGridSolver::direct);
+          }
+
+          gmg_refresh_energy_ = false;
+          gmg_reference_iterations_en_.clear();
+          n_gmg_rebuilds_energy_++;
         }
 
         LIKWID_MARKER_STOP("time_step_parabolic_2");
@@ -701,8 +1097,15 @@ namespace ryujin
             throw SolverControl::NoConvergence(0, 0.);
 
           using vt_float = LinearAlgebra::distributed::Vector<float>;
-          MGCoarseGridApplySmoother<vt_float> mg_coarse;
-          mg_coarse.initialize(mg_smoother_energy_);
+          MGCoarseGridApplySmoother<vt_float> mg_coarse_smoother;
+          mg_coarse_smoother.initialize(mg_smoother_energy_);
+
+          const MGCoarseGridBase<vt_float> &mg_coarse =
+              gmg_coarse_solver_ == CoarseGridSolver::chebyshev
+                  ? static_cast<const MGCoarseGridBase<vt_float> &>(
+                        mg_coarse_smoother)
+                  : mg_coarse_energy_;
+
           mg::Matrix<vt_float> mg_matrix(level_energy_matrices_);
 
           Multigrid<vt_float> mg(mg_matrix,
@@ -713,24 +1116,62 @@ namespace ryujin
                                  level_energy_matrices_.min_level(),
                                  level_energy_matrices_.max_level());
 
-          const auto &dof_handler = offline_data_->dof_handler();
           PreconditionMG<dim, vt_float, MGTransferEnergy<dim, float>>
-              preconditioner(dof_handler, mg, mg_transfer_energy_);
+              preconditioner(
+                  offline_data_->level_dof_handler(), mg, mg_transfer_energy_);
 
           SolverControl solver_control(gmg_max_iter_en_,
                                        tolerance_internal_energy);
           SolverCG<scalar_type> solver(solver_control);
-          solver.solve(energy_operator,
-                       internal_energy_,
-                       internal_energy_rhs_,
-                       preconditioner);
+
+          if constexpr (order > 1) {
+            /* p-multigrid, see Step 1: */
+            MGCoarseGridApplyPreconditioner<vt_float, decltype(preconditioner)>
+                p_coarse(preconditioner);
+            mg::Matrix<vt_float> p_matrix(p_level_energy_matrices_);
+            Multigrid<vt_float> p_mg(p_matrix,
+                                     p_coarse,
+                                     p_transfer_energy_,
+                                     p_smoother_energy_,
+                                     p_smoother_energy_,
+                                     1,
+                                     order);
+            PreconditionMG<dim, vt_float, MGTransferPolynomial<dim, vt_float>>
+                p_preconditioner(
+                    offline_data_->dof_handler(), p_mg, p_transfer_energy_);
+            solver.solve(energy_operator,
+                         internal_energy_,
+                         internal_energy_rhs_,
+                         p_preconditioner);
+          } else {
+            solver.solve(energy_operator,
+                         internal_energy_,
+                         internal_energy_rhs_,
+                         preconditioner);
+          }
 
           /* update exponential moving average */
           n_iterations_internal_energy_ = 0.9 * n_iterations_internal_energy_ +
                                           0.1 * solver_control.last_step();
 
+          /*
+           * Request a rebuild if the iteration count increased compared
+           * to the first solve of the same stage after the last rebuild:
+           */
+          const auto n_iterations = solver_control.last_step();
+          const auto [it, inserted] =
+              gmg_reference_iterations_en_.try_emplace(gmg_stage_,
+                                                        n_iterations);
+          if (!inserted &&
+              n_iterations >
+                  gmg_refresh_iteration_factor_ * std::max(it->second, 1u))
+            gmg_refresh_energy_ = true;
+
         } catch (SolverControl::NoConvergence &) {
 
+          /* GMG did not converge, request a rebuild: */
+          gmg_refresh_energy_ = use_gmg_internal_energy_;
+
           SolverControl solver_control(1000, tolerance_internal_energy);
           SolverCG<scalar_type> solver(solver_control);
           solver.solve(energy_operator,
@@ -768,6 +1209,8 @@ namespace ryujin
         LIKWID_MARKER_STOP("time_step_parabolic_2");
       }
 
+      update_history(t + theta_ * tau_);
+
       /*
        * Step 3: Copy vectors
        *
@@ -845,6 +1288,372 @@ namespace ryujin
     }
 
 
+    template <typename Description, int dim, typename Number>
+    void
+    ParabolicSolver<Description, dim, Number>::interpolate_level_densities()
+        const
+    {
+      constexpr auto order = Discretization<dim>::order_finite_element;
+      if constexpr (order > 1) {
+        p_transfer_velocity_.interpolate_to_mg(p_level_density_, density_);
+        mg_transfer_velocity_.interpolate_to_mg(
+            offline_data_->level_dof_handler(),
+            level_density_,
+            p_level_density_[1]);
+      } else {
+        mg_transfer_velocity_.interpolate_to_mg(
+            offline_data_->dof_handler(), level_density_, density_);
+      }
+    }
+
+
+    template <typename Description, int dim, typename Number>
+    bool ParabolicSolver<Description, dim, Number>::gmg_operators_outdated()
+        const
+    {
+      /* A refresh tolerance of zero requests a rebuild in every step: */
+      if (gmg_refresh_tolerance_ == 0.)
+        return true;
+
+      /* Reference value of theta * tau for the current stage: */
+      const Number theta_tau = theta_ * tau_;
+      const Number reference_theta_tau =
+          gmg_stage_factor_ * gmg_reference_tau_;
+      if (reference_theta_tau == Number(0.) ||
+          std::abs(theta_tau - reference_theta_tau) >
+              gmg_refresh_tolerance_ * reference_theta_tau)
+        return true;
+
+      /* Maximal relative change of the density: */
+
+      const unsigned int n_owned = offline_data_->n_locally_owned();
+      std::atomic<Number> change{Number(0.)};
+
+      RYUJIN_PARALLEL_REGION_BEGIN
+
+      Number local_change = Number(0.);
+
+      RYUJIN_OMP_FOR_NOWAIT
+      for (unsigned int i = 0; i < n_owned; ++i) {
+        const auto rho_reference = gmg_reference_density_.local_element(i);
+        /* Skip constrained degrees of freedom: */
+        if (rho_reference == Number(0.))
+          continue;
+        const auto rho_i = density_.local_element(i);
+        const auto relative_change =
+            std::abs(rho_i - rho_reference) / rho_reference;
+        local_change = std::max(local_change, relative_change);
+      }
+
+      Number current_change = change.load();
+      while (current_change < local_change &&
+             !change.compare_exchange_weak(current_change, local_change))
+        ;
+
+      RYUJIN_PARALLEL_REGION_END
+
+      const auto global_change =
+          Utilities::MPI::max(change.load(), mpi_communicator_);
+      return global_change > gmg_refresh_tolerance_;
+    }
+
+
+    template <typename Description, int dim, typename Number>
+    std::vector<Number>
+    ParabolicSolver<Description, dim, Number>::extrapolation_weights(
+        const Number t) const
+    {
+      const unsigned int n_nodes =
+          std::min(history_times_.size(), velocity_history_.size());
+      if (n_nodes < 2)
+        return {};
+
+      /* Lagrange basis polynomials evaluated at t: */
+      std::vector<Number> weights(n_nodes, Number(1.));
+      for (unsigned int k = 0; k < n_nodes; ++k)
+        for (unsigned int l = 0; l < n_nodes; ++l)
+          if (l != k)
+            weights[k] *= (t - history_times_[l]) /
+                          (history_times_[k] - history_times_[l]);
+
+      return weights;
+    }
+
+
+    template <typename Description, int dim, typename Number>
+    void ParabolicSolver<Description, dim, Number>::update_history(
+        const Number t) const
+    {
+      const unsigned int n_slots = velocity_history_.size();
+      if (n_slots == 0)
+        return;
+
+      /* Drop entries that do not precede t, as well as the oldest entry: */
+      while (!history_times_.empty() && history_times_.front() >= t) {
+        history_times_.erase(history_times_.begin());
+        history_slots_.erase(history_slots_.begin());
+      }
+      if (history_times_.size() == n_slots) {
+        history_times_.pop_back();
+        history_slots_.pop_back();
+      }
+
+      /* Find an unused storage slot: */
+      unsigned int slot = 0;
+      while (std::find(history_slots_.begin(), history_slots_.end(), slot) !=
+             history_slots_.end())
+        ++slot;
+
+      velocity_history_[slot] = velocity_;
+      internal_energy_history_[slot] = internal_energy_;
+      history_times_.insert(history_times_.begin(), t);
+      history_slots_.insert(history_slots_.begin(), slot);
+    }
+
+
+    template <typename Description, int dim, typename Number>
+    void ParabolicSolver<Description, dim, Number>::add_explicit_residual(
+        const vector_type &stage_U, const Number factor, vector_type &U) const
+    {
+#ifdef DEBUG_OUTPUT
+      std::cout << "ParabolicSolver<dim, Number>::add_explicit_residual()"
+                << std::endl;
+#endif
+
+      Scope scope(computing_timer_, "time step [P] 0 - explicit residual");
+
+      using VA = VectorizedArray<Number>;
+      constexpr auto simd_length = VA::size();
+
+      const auto &lumped_mass_matrix = offline_data_->lumped_mass_matrix();
+      const unsigned int n_owned = offline_data_->n_locally_owned();
+      const unsigned int size_regular = n_owned / simd_length * simd_length;
+
+      /*
+       * Step 1: Populate velocity and internal energy of the stage:
+       */
+
+      RYUJIN_PARALLEL_REGION_BEGIN
+
+      RYUJIN_OMP_FOR
+      for (unsigned int i = 0; i < size_regular; i += simd_length) {
+        const auto U_i = stage_U.template get_tensor<VA>(i);
+        const auto view = hyperbolic_system_->template view<dim, VA>();
+        const auto rho_i = view.density(U_i);
+        const auto M_i = view.momentum(U_i);
+        const auto rho_e_i = view.internal_energy(U_i);
+
+        for (unsigned int d = 0; d < dim; ++d)
+          store_value<VA>(velocity_.block(d), M_i[d] / rho_i, i);
+        store_value<VA>(internal_energy_, rho_e_i / rho_i, i);
+      }
+
+      RYUJIN_PARALLEL_REGION_END
+
+      for (unsigned int i = size_regular; i < n_owned; ++i) {
+        const auto U_i = stage_U.get_tensor(i);
+        const auto view = hyperbolic_system_->template view<dim, Number>();
+        const auto rho_i = view.density(U_i);
+        const auto M_i = view.momentum(U_i);
+        const auto rho_e_i = view.internal_energy(U_i);
+
+        for (unsigned int d = 0; d < dim; ++d)
+          velocity_.block(d).local_element(i) = M_i[d] / rho_i;
+        internal_energy_.local_element(i) = rho_e_i / rho_i;
+      }
+
+      internal_energy_.update_ghost_values();
+
+      /*
+       * Step 2: Compute -factor * sum_j B_ij V_j and
+       * factor * (m_i K_i - c_v^{-1} kappa sum_j beta_ij e_j):
+       */
+
+      const auto mu = parabolic_system_->mu();
+      const auto lambda = parabolic_system_->lambda();
+      const auto cv_inverse_kappa = parabolic_system_->cv_inverse_kappa();
+
+      constexpr auto order_fe = Discretization<dim>::order_finite_element;
+      constexpr auto order_quad = Discretization<dim>::order_quadrature;
+
+      matrix_free_.template cell_loop<block_vector_type, block_vector_type>(
+          [&](const auto &data,
+              auto &dst,
+              const auto &src,
+              const auto cell_range) {
+            FEEvaluation<dim, order_fe, order_quad, dim, Number> velocity(data);
+
+            for (unsigned int cell = cell_range.first; cell < cell_range.second;
+                 ++cell) {
+              velocity.reinit(cell);
+              velocity.gather_evaluate(src, EvaluationFlags::gradients);
+
+              for (unsigned int q = 0; q < velocity.n_q_points; ++q) {
+                if constexpr (dim == 1) {
+                  /* Workaround: no symmetric gradient for dim == 1: */
+                  const auto gradient = velocity.get_gradient(q);
+                  auto S = (4. / 3. * mu + lambda) * gradient;
+                  velocity.submit_gradient(-factor * S, q);
+
+                } else {
+
+                  const auto symmetric_gradient =
+                      velocity.get_symmetric_gradient(q);
+                  const auto divergence = trace(symmetric_gradient);
+                  auto S = 2. * mu * symmetric_gradient;
+                  for (unsigned int d = 0; d < dim; ++d)
+                    S[d][d] += (lambda - 2. / 3. * mu) * divergence;
+                  velocity.submit_symmetric_gradient(-factor * S, q);
+                }
+              }
+              velocity.integrate_scatter(EvaluationFlags::gradients, dst);
+            }
+          },
+          velocity_rhs_,
+          velocity_,
+          /* zero destination */ true);
+
+      matrix_free_.template cell_loop<scalar_type, block_vector_type>(
+          [&](const auto &data,
+              auto &dst,
+              const auto &src,
+              const auto cell_range) {
+            FEEvaluation<dim, order_fe, order_quad, dim, Number> velocity(data);
+            FEEvaluation<dim, order_fe, order_quad, 1, Number> energy(data);
+
+            for (unsigned int cell = cell_range.first; cell < cell_range.second;
+                 ++cell) {
+              velocity.reinit(cell);
+              energy.reinit(cell);
+              velocity.gather_evaluate(src, EvaluationFlags::gradients);
+              energy.gather_evaluate(internal_energy_,
+                                     EvaluationFlags::gradients);
+
+              for (unsigned int q = 0; q < velocity.n_q_points; ++q) {
+                if constexpr (dim == 1) {
+                  /* Workaround: no symmetric gradient for dim == 1: */
+                  const auto gradient = velocity.get_gradient(q);
+                  auto S = (4. / 3. * mu + lambda) * gradient;
+                  energy.submit_value(factor * (gradient * S), q);
+
+                } else {
+
+                  const auto symmetric_gradient =
+                      velocity.get_symmetric_gradient(q);
+                  const auto divergence = trace(symmetric_gradient);
+                  auto S = 2. * mu * symmetric_gradient;
+                  for (unsigned int d = 0; d < dim; ++d)
+                    S[d][d] += (lambda - 2. / 3. * mu) * divergence;
+                  energy.submit_value(factor * (symmetric_gradient * S), q);
+                }
+
+                energy.submit_gradient(
+                    -factor * cv_inverse_kappa * energy.get_gradient(q), q);
+              }
+              energy.integrate_scatter(EvaluationFlags::values |
+                                           EvaluationFlags::gradients,
+                                       dst);
+            }
+          },
+          internal_energy_rhs_,
+          velocity_,
+          /* zero destination */ true);
+
+      internal_energy_.zero_out_ghost_values();
+
+      /*
+       * Step 3: Remove contributions on boundary degrees of freedom that
+       * are subsequently overwritten by the implicit solve:
+       */
+
+      const auto &boundary_map = offline_data_->boundary_map();
+
+      for (auto entry : boundary_map) {
+        const auto i = entry.first;
+        if (i >= n_owned)
+          continue;
+
+        const auto normal = std::get<0>(entry.second);
+        const auto id = std::get<3>(entry.second);
+
+        if (id == Boundary::slip) {
+          Tensor<1, dim, Number> RHS_i;
+          for (unsigned int d = 0; d < dim; ++d)
+            RHS_i[d] = velocity_rhs_.block(d).local_element(i);
+          RHS_i -= 1. * (RHS_i * normal) * normal;
+          for (unsigned int d = 0; d < dim; ++d)
+            velocity_rhs_.block(d).local_element(i) = RHS_i[d];
+
+        } else if (id == Boundary::no_slip || id == Boundary::dirichlet) {
+          for (unsigned int d = 0; d < dim; ++d)
+            velocity_rhs_.block(d).local_element(i) = Number(0.);
+        }
+
+        if (id == Boundary::dirichlet)
+          internal_energy_rhs_.local_element(i) = Number(0.);
+      }
+
+      /*
+       * Step 4: Update momentum and total energy. The change of total
+       * energy is V_i * dM_i + d(rho e)_i, which sums up to zero (up to
+       * boundary fluxes) over all degrees of freedom.
+       */
+
+      RYUJIN_PARALLEL_REGION_BEGIN
+
+      RYUJIN_OMP_FOR
+      for (unsigned int i = 0; i < size_regular; i += simd_length) {
+        auto U_i = U.template get_tensor<VA>(i);
+        const auto m_i_inverse =
+            VA(1.) / load_value<VA>(lumped_mass_matrix, i);
+
+        auto dE_i = m_i_inverse * load_value<VA>(internal_energy_rhs_, i);
+        for (unsigned int d = 0; d < dim; ++d) {
+          const auto dM_i =
+              m_i_inverse * load_value<VA>(velocity_rhs_.block(d), i);
+          U_i[1 + d] += dM_i;
+          dE_i += load_value<VA>(velocity_.block(d), i) * dM_i;
+        }
+        U_i[1 + dim] += dE_i;
+
+        U.template write_tensor<VA>(U_i, i);
+      }
+
+      RYUJIN_PARALLEL_REGION_END
+
+      for (unsigned int i = size_regular; i < n_owned; ++i) {
+        auto U_i = U.get_tensor(i);
+        const auto m_i_inverse =
+            Number(1.) / lumped_mass_matrix.local_element(i);
+
+        auto dE_i = m_i_inverse * internal_energy_rhs_.local_element(i);
+        for (unsigned int d = 0; d < dim; ++d) {
+          const auto dM_i =
+              m_i_inverse * velocity_rhs_.block(d).local_element(i);
+          U_i[1 + d] += dM_i;
+          dE_i += velocity_.block(d).local_element(i) * dM_i;
+        }
+        U_i[1 + dim] += dE_i;
+
+        U.write_tensor(U_i, i);
+      }
+
+      U.update_ghost_values();
+    }
+
+
+    template <typename Description, int dim, typename Number>
+    void ParabolicSolver<Description, dim, Number>::reset_statistics() const
+    {
+      n_restarts_ = 0;
+      n_warnings_ = 0;
+      n_iterations_velocity_ = 0.;
+      n_iterations_internal_energy_ = 0.;
+      n_gmg_rebuilds_velocity_ = 0;
+      n_gmg_rebuilds_energy_ = 0;
+    }
+
+
     template <typename Description, int dim, typename Number>
     void ParabolicSolver<Description, dim, Number>::print_solver_statistics(
         std::ostream &output) const
@@ -853,8 +1662,35 @@ namespace ryujin
              << n_iterations_velocity_
              << (use_gmg_velocity_ ? " GMG vel -- " : " CG vel -- ")
              << n_iterations_internal_energy_
-             << (use_gmg_internal_energy_ ? " GMG int ]" : " CG int ]")
-             << std::endl;
+             << (use_gmg_internal_energy_ ? " GMG int ]" : " CG int ]");
+      if (use_gmg_velocity_ || use_gmg_internal_energy_)
+        output << " [ " << n_gmg_rebuilds_velocity_ << " vel -- "
+               << n_gmg_rebuilds_energy_ << " int GMG rebuilds ]";
+      output << std::endl;
+    }
+
+
+    template <typename Description, int dim, typename Number>
+    void ParabolicSolver<Description, dim, Number>::memory_statistics(
+        std::map<std::string, std::size_t> &statistics) const
+    {
+      statistics["ParabolicSolver - matrix free"] =
+          matrix_free_.memory_consumption();
+      statistics["ParabolicSolver - vectors"] =
+          velocity_.memory_consumption() + velocity_rhs_.memory_consumption() +
+          internal_energy_.memory_consumption() +
+          internal_energy_rhs_.memory_consumption() +
+          density_.memory_consumption() + explicit_U_.memory_consumption() +
+          gmg_reference_density_.memory_consumption() +
+          MemoryConsumption::memory_consumption(velocity_history_) +
+          MemoryConsumption::memory_consumption(internal_energy_history_);
+      statistics["ParabolicSolver - level data"] =
+          level_matrix_free_.memory_consumption() +
+          level_density_.memory_consumption() +
+          p_level_matrix_free_.memory_consumption() +
+          p_level_density_.memory_consumption() +
+          mg_coarse_velocity_.memory_consumption() +
+          mg_coarse_energy_.memory_consumption();
     }
 
   } // namespace NavierStokes
@@ -13,11 +13,26 @@
 #include "parabolic_system.h"
 
 #include <deal.II/base/vectorization.h>
+#include <deal.II/dofs/dof_tools.h>
+#include <deal.II/fe/fe_values.h>
 #include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/la_parallel_block_vector.h>
+#include <deal.II/lac/sparsity_tools.h>
+#ifdef DEAL_II_WITH_TRILINOS
+#include <deal.II/lac/trilinos_precondition.h>
+#include <deal.II/lac/trilinos_solver.h>
+#include <deal.II/lac/trilinos_sparse_matrix.h>
+#include <deal.II/lac/trilinos_vector.h>
+#endif
 #include <deal.II/matrix_free/fe_evaluation.h>
 #include <deal.II/multigrid/mg_base.h>
+#include <deal.II/multigrid/mg_transfer_global_coarsening.h>
 #include <deal.II/multigrid/mg_transfer_matrix_free.h>
 
+#include <map>
+#include <memory>
+
 /*
  * FIXME: generalize and make these operators equation independent and
  * refactor into ../parabolic_module_gmg_operators.h
@@ -162,13 +177,19 @@ namespace ryujin
 
       VelocityMatrix() = default;
 
+      /**
+       * Initialize the operator. If @p p_level is true then @p level is
+       * the polynomial degree of a level of the p-multigrid hierarchy
+       * instead of a level of the geometric multigrid hierarchy.
+       */
       void initialize(
           const ParabolicSystem &parabolic_system,
           const OfflineData<dim, Number2> &offline_data,
           const dealii::MatrixFree<dim, Number> &matrix_free,
           const dealii::LinearAlgebra::distributed::Vector<Number> &density,
           const Number theta_x_tau,
-          const unsigned int level = dealii::numbers::invalid_unsigned_int)
+          const unsigned int level = dealii::numbers::invalid_unsigned_int,
+          const bool p_level = false)
       {
         parabolic_system_ = &parabolic_system;
         offline_data_ = &offline_data;
@@ -176,6 +197,7 @@ namespace ryujin
         density_ = &density;
         theta_x_tau_ = theta_x_tau;
         level_ = level;
+        p_level_ = p_level;
       }
 
       void Tvmult(block_vector_type &dst, const block_vector_type &src) const
@@ -190,22 +212,7 @@ namespace ryujin
         using VA = dealii::VectorizedArray<Number>;
         constexpr auto simd_length = VA::size();
 
-        const vector_type *lumped_mass_matrix = nullptr;
-        if constexpr (std::is_same<Number, Number2>::value) {
-          if constexpr (std::is_same<Number, float>::value) {
-            if (level_ == dealii::numbers::invalid_unsigned_int)
-              lumped_mass_matrix = &offline_data_->lumped_mass_matrix();
-            else
-              lumped_mass_matrix =
-                  &offline_data_->level_lumped_mass_matrix()[level_];
-          } else {
-            Assert(level_ == dealii::numbers::invalid_unsigned_int,
-                   dealii::ExcInternalError());
-            lumped_mass_matrix = &offline_data_->lumped_mass_matrix();
-          }
-        } else
-          lumped_mass_matrix =
-              &offline_data_->level_lumped_mass_matrix()[level_];
+        const vector_type *lumped_mass_matrix = &get_lumped_mass_matrix();
 
         const unsigned int n_owned =
             lumped_mass_matrix->get_partitioner()->locally_owned_size();
@@ -237,32 +244,27 @@ namespace ryujin
 
         /* Apply action of stress tensor: + theta * \sum_j B_ij V_j: */
 
-        const auto integrator = [this](const auto &data,
-                                       auto &dst,
-                                       const auto &src,
-                                       const auto range) {
-          constexpr auto order_fe = Discretization<dim>::order_finite_element;
-          constexpr auto order_quad = Discretization<dim>::order_quadrature;
-          dealii::FEEvaluation<dim, order_fe, order_quad, dim, Number> velocity(
-              data);
-
-          for (unsigned int cell = range.first; cell < range.second; ++cell) {
-            velocity.reinit(cell);
-            velocity.read_dof_values(src);
-            apply_local_operator(velocity);
-            velocity.distribute_local_to_global(dst);
-          }
-        };
-
-        matrix_free_->template cell_loop<block_vector_type, block_vector_type>(
-            integrator, dst, src, /* zero destination */ false);
+        constexpr auto order_fe = Discretization<dim>::order_finite_element;
+        constexpr auto order_quad = Discretization<dim>::order_quadrature;
+
+        if (matrix_free_->get_dof_handler().get_fe().degree == order_fe)
+          matrix_free_->cell_loop(
+              &VelocityMatrix::local_vmult<order_fe, order_quad>,
+              this,
+              dst,
+              src,
+              /* zero destination */ false);
+        else
+          /* Lower polynomial degree of the p-multigrid hierarchy: */
+          matrix_free_->cell_loop(&VelocityMatrix::local_vmult<-1, 0>,
+                                  this,
+                                  dst,
+                                  src,
+                                  /* zero destination */ false);
 
         /* (5.4a) Fix up constrained degrees of freedom: */
 
-        const auto &boundary_map =
-            level_ == dealii::numbers::invalid_unsigned_int
-                ? offline_data_->boundary_map()
-                : offline_data_->level_boundary_map()[level_];
+        const auto &boundary_map = get_boundary_map();
 
         for (auto entry : boundary_map) {
           const auto i = entry.first;
@@ -309,40 +311,26 @@ namespace ryujin
           matrix_free_->initialize_dof_vector(vector.block(d));
         vector.collect_sizes();
 
-        const auto &lumped_mass_matrix =
-            offline_data_->level_lumped_mass_matrix()[level_];
+        const auto &lumped_mass_matrix = get_lumped_mass_matrix();
+
+        constexpr auto order_fe = Discretization<dim>::order_finite_element;
+        constexpr auto order_quad = Discretization<dim>::order_quadrature;
 
         unsigned int dummy = 0;
-        matrix_free_->template cell_loop<block_vector_type, unsigned int>(
-            [this](
-                const auto &data, auto &dst, const auto &, const auto range) {
-              constexpr auto order_fe =
-                  Discretization<dim>::order_finite_element;
-              constexpr auto order_quad = Discretization<dim>::order_quadrature;
-              dealii::FEEvaluation<dim, order_fe, order_quad, dim, Number>
-                  velocity(data);
-              dealii::FEEvaluation<dim, order_fe, order_quad, dim, Number>
-                  writer(data);
-
-              for (unsigned int cell = range.first; cell < range.second;
-                   ++cell) {
-                velocity.reinit(cell);
-                writer.reinit(cell);
-                for (unsigned int i = 0; i < velocity.dofs_per_cell; ++i) {
-                  for (unsigned int j = 0; j < velocity.dofs_per_cell; ++j)
-                    velocity.begin_dof_values()[j] =
-                        dealii::VectorizedArray<Number>();
-                  velocity.begin_dof_values()[i] =
-                      dealii::make_vectorized_array<Number>(1.);
-                  apply_local_operator(velocity);
-                  writer.begin_dof_values()[i] = velocity.begin_dof_values()[i];
-                }
-                writer.distribute_local_to_global(dst);
-              }
-            },
-            vector,
-            dummy,
-            /* zero destination */ true);
+        if (matrix_free_->get_dof_handler().get_fe().degree == order_fe)
+          matrix_free_->cell_loop(
+              &VelocityMatrix::local_diagonal<order_fe, order_quad>,
+              this,
+              vector,
+              dummy,
+              /* zero destination */ true);
+        else
+          /* Lower polynomial degree of the p-multigrid hierarchy: */
+          matrix_free_->cell_loop(&VelocityMatrix::local_diagonal<-1, 0>,
+                                  this,
+                                  vector,
+                                  dummy,
+                                  /* zero destination */ true);
 
         const unsigned int n_owned =
             lumped_mass_matrix.get_partitioner()->locally_owned_size();
@@ -360,7 +348,15 @@ namespace ryujin
 
         RYUJIN_PARALLEL_REGION_END
 
-        const auto &boundary_map = offline_data_->level_boundary_map()[level_];
+        /*
+         * Fix up diagonal entries for constrained degrees of freedom due to
+         * periodic boundary conditions.
+         */
+        const auto &level_constraints = get_level_constraints();
+        for (unsigned int d = 0; d < dim; ++d)
+          level_constraints.set_zero(vector.block(d));
+
+        const auto &boundary_map = get_boundary_map();
 
         for (auto entry : boundary_map) {
           const auto i = entry.first;
@@ -401,6 +397,86 @@ namespace ryujin
       const vector_type *density_;
       Number theta_x_tau_;
       unsigned int level_;
+      bool p_level_;
+
+      const vector_type &get_lumped_mass_matrix() const
+      {
+        if constexpr (std::is_same<Number, float>::value) {
+          if (p_level_)
+            return offline_data_->p_level_lumped_mass_matrix()[level_];
+          if constexpr (!std::is_same<Number, Number2>::value)
+            return offline_data_->level_lumped_mass_matrix()[level_];
+          else if (level_ != dealii::numbers::invalid_unsigned_int)
+            return offline_data_->level_lumped_mass_matrix()[level_];
+        }
+        if constexpr (std::is_same<Number, Number2>::value) {
+          Assert(level_ == dealii::numbers::invalid_unsigned_int,
+                 dealii::ExcInternalError());
+          return offline_data_->lumped_mass_matrix();
+        }
+      }
+
+      const auto &get_boundary_map() const
+      {
+        if (p_level_)
+          return offline_data_->p_level_boundary_map()[level_];
+        if (level_ == dealii::numbers::invalid_unsigned_int)
+          return offline_data_->boundary_map();
+        return offline_data_->level_boundary_map()[level_];
+      }
+
+      const auto &get_level_constraints() const
+      {
+        if (p_level_)
+          return offline_data_->p_level_affine_constraints()[level_];
+        return offline_data_->level_affine_constraints()[level_];
+      }
+
+      template <int fe_degree, int n_q_points_1d>
+      void
+      local_vmult(const dealii::MatrixFree<dim, Number> &data,
+                  block_vector_type &dst,
+                  const block_vector_type &src,
+                  const std::pair<unsigned int, unsigned int> &range) const
+      {
+        dealii::FEEvaluation<dim, fe_degree, n_q_points_1d, dim, Number>
+            velocity(data);
+
+        for (unsigned int cell = range.first; cell < range.second; ++cell) {
+          velocity.reinit(cell);
+          velocity.read_dof_values(src);
+          apply_local_operator(velocity);
+          velocity.distribute_local_to_global(dst);
+        }
+      }
+
+      template <int fe_degree, int n_q_points_1d>
+      void
+      local_diagonal(const dealii::MatrixFree<dim, Number> &data,
+                     block_vector_type &dst,
+                     const unsigned int &,
+                     const std::pair<unsigned int, unsigned int> &range) const
+      {
+        dealii::FEEvaluation<dim, fe_degree, n_q_points_1d, dim, Number>
+            velocity(data);
+        dealii::FEEvaluation<dim, fe_degree, n_q_points_1d, dim, Number>
+            writer(data);
+
+        for (unsigned int cell = range.first; cell < range.second; ++cell) {
+          velocity.reinit(cell);
+          writer.reinit(cell);
+          for (unsigned int i = 0; i < velocity.dofs_per_cell; ++i) {
+            for (unsigned int j = 0; j < velocity.dofs_per_cell; ++j)
+              velocity.begin_dof_values()[j] =
+                  dealii::VectorizedArray<Number>();
+            velocity.begin_dof_values()[i] =
+                dealii::make_vectorized_array<Number>(1.);
+            apply_local_operator(velocity);
+            writer.begin_dof_values()[i] = velocity.begin_dof_values()[i];
+          }
+          writer.distribute_local_to_global(dst);
+        }
+      }
 
       template <typename Evaluator>
       void apply_local_operator(Evaluator &velocity) const
@@ -552,18 +628,25 @@ namespace ryujin
 
       EnergyMatrix() = default;
 
+      /**
+       * Initialize the operator. If @p p_level is true then @p level is
+       * the polynomial degree of a level of the p-multigrid hierarchy
+       * instead of a level of the geometric multigrid hierarchy.
+       */
       void initialize(
           const OfflineData<dim, Number2> &offline_data,
           const dealii::MatrixFree<dim, Number> &matrix_free,
           const dealii::LinearAlgebra::distributed::Vector<Number> &density,
           const Number time_factor,
-          const unsigned int level = dealii::numbers::invalid_unsigned_int)
+          const unsigned int level = dealii::numbers::invalid_unsigned_int,
+          const bool p_level = false)
       {
         offline_data_ = &offline_data;
         matrix_free_ = &matrix_free;
         density_ = &density;
         factor_ = time_factor;
         level_ = level;
+        p_level_ = p_level;
       }
 
       void Tvmult(vector_type &dst, const vector_type &src) const
@@ -589,22 +672,7 @@ namespace ryujin
         using VA = dealii::VectorizedArray<Number>;
         constexpr auto simd_length = VA::size();
 
-        const vector_type *lumped_mass_matrix = nullptr;
-        if constexpr (std::is_same<Number, Number2>::value) {
-          if constexpr (std::is_same<Number, float>::value) {
-            if (level_ == dealii::numbers::invalid_unsigned_int)
-              lumped_mass_matrix = &offline_data_->lumped_mass_matrix();
-            else
-              lumped_mass_matrix =
-                  &offline_data_->level_lumped_mass_matrix()[level_];
-          } else {
-            Assert(level_ == dealii::numbers::invalid_unsigned_int,
-                   dealii::ExcInternalError());
-            lumped_mass_matrix = &offline_data_->lumped_mass_matrix();
-          }
-        } else
-          lumped_mass_matrix =
-              &offline_data_->level_lumped_mass_matrix()[level_];
+        const vector_type *lumped_mass_matrix = &get_lumped_mass_matrix();
 
         const unsigned int n_owned =
             lumped_mass_matrix->get_partitioner()->locally_owned_size();
@@ -631,32 +699,27 @@ namespace ryujin
 
         /* Apply action of diffusion operator \sum_j beta_ij e_j: */
 
-        const auto integrator = [this](const auto &data,
-                                       auto &dst,
-                                       const auto &src,
-                                       const auto range) {
-          constexpr auto order_fe = Discretization<dim>::order_finite_element;
-          constexpr auto order_quad = Discretization<dim>::order_quadrature;
-          dealii::FEEvaluation<dim, order_fe, order_quad, 1, Number> energy(
-              data);
-
-          for (unsigned int cell = range.first; cell < range.second; ++cell) {
-            energy.reinit(cell);
-            energy.read_dof_values(src);
-            apply_local_operator(energy);
-            energy.distribute_local_to_global(dst);
-          }
-        };
-
-        matrix_free_->template cell_loop<vector_type, vector_type>(
-            integrator, dst, src, /* zero destination */ false);
+        constexpr auto order_fe = Discretization<dim>::order_finite_element;
+        constexpr auto order_quad = Discretization<dim>::order_quadrature;
+
+        if (matrix_free_->get_dof_handler().get_fe().degree == order_fe)
+          matrix_free_->cell_loop(
+              &EnergyMatrix::local_vmult<order_fe, order_quad>,
+              this,
+              dst,
+              src,
+              /* zero destination */ false);
+        else
+          /* Lower polynomial degree of the p-multigrid hierarchy: */
+          matrix_free_->cell_loop(&EnergyMatrix::local_vmult<-1, 0>,
+                                  this,
+                                  dst,
+                                  src,
+                                  /* zero destination */ false);
 
         /* Fix up constrained degrees of freedom: */
 
-        const auto &boundary_map =
-            (level_ == dealii::numbers::invalid_unsigned_int)
-                ? offline_data_->boundary_map()
-                : offline_data_->level_boundary_map()[level_];
+        const auto &boundary_map = get_boundary_map();
 
         for (auto entry : boundary_map) {
           const auto i = entry.first;
@@ -678,40 +741,26 @@ namespace ryujin
         vector_type &vector = matrix->get_vector();
         matrix_free_->initialize_dof_vector(vector);
 
-        const vector_type &lumped_mass_matrix =
-            offline_data_->level_lumped_mass_matrix()[level_];
+        const vector_type &lumped_mass_matrix = get_lumped_mass_matrix();
+
+        constexpr auto order_fe = Discretization<dim>::order_finite_element;
+        constexpr auto order_quad = Discretization<dim>::order_quadrature;
 
         unsigned int dummy = 0;
-        matrix_free_->template cell_loop<vector_type, unsigned int>(
-            [this](
-                const auto &data, auto &dst, const auto &, const auto range) {
-              constexpr auto order_fe =
-                  Discretization<dim>::order_finite_element;
-              constexpr auto order_quad = Discretization<dim>::order_quadrature;
-              dealii::FEEvaluation<dim, order_fe, order_quad, 1, Number> energy(
-                  data);
-              dealii::FEEvaluation<dim, order_fe, order_quad, 1, Number> writer(
-                  data);
-
-              for (unsigned int cell = range.first; cell < range.second;
-                   ++cell) {
-                energy.reinit(cell);
-                writer.reinit(cell);
-                for (unsigned int i = 0; i < energy.dofs_per_cell; ++i) {
-                  for (unsigned int j = 0; j < energy.dofs_per_cell; ++j)
-                    energy.begin_dof_values()[j] =
-                        dealii::VectorizedArray<Number>();
-                  energy.begin_dof_values()[i] =
-                      dealii::make_vectorized_array<Number>(1.);
-                  apply_local_operator(energy);
-                  writer.begin_dof_values()[i] = energy.begin_dof_values()[i];
-                }
-                writer.distribute_local_to_global(dst);
-              }
-            },
-            vector,
-            dummy,
-            /* zero destination */ true);
+        if (matrix_free_->get_dof_handler().get_fe().degree == order_fe)
+          matrix_free_->cell_loop(
+              &EnergyMatrix::local_diagonal<order_fe, order_quad>,
+              this,
+              vector,
+              dummy,
+              /* zero destination */ true);
+        else
+          /* Lower polynomial degree of the p-multigrid hierarchy: */
+          matrix_free_->cell_loop(&EnergyMatrix::local_diagonal<-1, 0>,
+                                  this,
+                                  vector,
+                                  dummy,
+                                  /* zero destination */ true);
 
         const unsigned int n_owned =
             lumped_mass_matrix.get_partitioner()->locally_owned_size();
@@ -728,7 +777,13 @@ namespace ryujin
 
         RYUJIN_PARALLEL_REGION_END
 
-        const auto &boundary_map = offline_data_->level_boundary_map()[level_];
+        /*
+         * Fix up diagonal entries for constrained degrees of freedom due to
+         * periodic boundary conditions.
+         */
+        get_level_constraints().set_zero(vector);
+
+        const auto &boundary_map = get_boundary_map();
 
         for (auto entry : boundary_map) {
           const auto i = entry.first;
@@ -747,6 +802,84 @@ namespace ryujin
       const dealii::LinearAlgebra::distributed::Vector<Number> *density_;
       Number factor_;
       unsigned int level_;
+      bool p_level_;
+
+      const vector_type &get_lumped_mass_matrix() const
+      {
+        if constexpr (std::is_same<Number, float>::value) {
+          if (p_level_)
+            return offline_data_->p_level_lumped_mass_matrix()[level_];
+          if constexpr (!std::is_same<Number, Number2>::value)
+            return offline_data_->level_lumped_mass_matrix()[level_];
+          else if (level_ != dealii::numbers::invalid_unsigned_int)
+            return offline_data_->level_lumped_mass_matrix()[level_];
+        }
+        if constexpr (std::is_same<Number, Number2>::value) {
+          Assert(level_ == dealii::numbers::invalid_unsigned_int,
+                 dealii::ExcInternalError());
+          return offline_data_->lumped_mass_matrix();
+        }
+      }
+
+      const auto &get_boundary_map() const
+      {
+        if (p_level_)
+          return offline_data_->p_level_boundary_map()[level_];
+        if (level_ == dealii::numbers::invalid_unsigned_int)
+          return offline_data_->boundary_map();
+        return offline_data_->level_boundary_map()[level_];
+      }
+
+      const auto &get_level_constraints() const
+      {
+        if (p_level_)
+          return offline_data_->p_level_affine_constraints()[level_];
+        return offline_data_->level_affine_constraints()[level_];
+      }
+
+      template <int fe_degree, int n_q_points_1d>
+      void local_vmult(const dealii::MatrixFree<dim, Number> &data,
+                       vector_type &dst,
+                       const vector_type &src,
+                       const std::pair<unsigned int, unsigned int> &range) const
+      {
+        dealii::FEEvaluation<dim, fe_degree, n_q_points_1d, 1, Number> energy(
+            data);
+
+        for (unsigned int cell = range.first; cell < range.second; ++cell) {
+          energy.reinit(cell);
+          energy.read_dof_values(src);
+          apply_local_operator(energy);
+          energy.distribute_local_to_global(dst);
+        }
+      }
+
+      template <int fe_degree, int n_q_points_1d>
+      void
+      local_diagonal(const dealii::MatrixFree<dim, Number> &data,
+                     vector_type &dst,
+                     const unsigned int &,
+                     const std::pair<unsigned int, unsigned int> &range) const
+      {
+        dealii::FEEvaluation<dim, fe_degree, n_q_points_1d, 1, Number> energy(
+            data);
+        dealii::FEEvaluation<dim, fe_degree, n_q_points_1d, 1, Number> writer(
+            data);
+
+        for (unsigned int cell = range.first; cell < range.second; ++cell) {
+          energy.reinit(cell);
+          writer.reinit(cell);
+          for (unsigned int i = 0; i < energy.dofs_per_cell; ++i) {
+            for (unsigned int j = 0; j < energy.dofs_per_cell; ++j)
+              energy.begin_dof_values()[j] = dealii::VectorizedArray<Number>();
+            energy.begin_dof_values()[i] =
+                dealii::make_vectorized_array<Number>(1.);
+            apply_local_operator(energy);
+            writer.begin_dof_values()[i] = energy.begin_dof_values()[i];
+          }
+          writer.distribute_local_to_global(dst);
+        }
+      }
 
       template <typename Evaluator>
       void apply_local_operator(Evaluator &energy) const
@@ -794,6 +927,506 @@ namespace ryujin
           *level_matrix_free_;
     };
 
+
+    /**
+     * The transfer between the levels of the p-multigrid hierarchy, i.e.,
+     * the finite element spaces of polynomial degree 1, ...,
+     * Discretization::order_finite_element on the active mesh (see
+     * OfflineData::p_level_dof_handler()). The level index is the
+     * polynomial degree. VectorType is either a block vector with dim
+     * blocks (velocity) or a scalar vector (internal energy); blocks are
+     * transferred one after another with the same (scalar) two-level
+     * transfer operators.
+     *
+     * @ingroup ParabolicModule
+     */
+    template <int dim, typename VectorType>
+    class MGTransferPolynomial final
+        : public dealii::MGTransferBase<VectorType>
+    {
+    public:
+      using Number = typename VectorType::value_type;
+      using scalar_type = dealii::LinearAlgebra::distributed::Vector<Number>;
+      using transfer_type = dealii::MGTwoLevelTransfer<dim, scalar_type>;
+
+      static constexpr bool is_block =
+          dealii::IsBlockVector<VectorType>::value;
+
+      MGTransferPolynomial() = default;
+
+      /**
+       * Set up the transfer: @p transfers holds on level p the transfer
+       * between the spaces of degree p - 1 and p, @p matrix_free the
+       * MatrixFree objects of all polynomial degrees.
+       */
+      void build(const dealii::MGLevelObject<transfer_type> &transfers,
+                 const dealii::MGLevelObject<dealii::MatrixFree<dim, Number>>
+                     &matrix_free)
+      {
+        transfers_ = &transfers;
+        level_matrix_free_ = &matrix_free;
+      }
+
+      void prolongate(const unsigned int to_level,
+                      VectorType &dst,
+                      const VectorType &src) const override
+      {
+        dst = Number(0.);
+        if constexpr (is_block) {
+          for (unsigned int block = 0; block < src.n_blocks(); ++block)
+            prolongate_and_add(
+                (*transfers_)[to_level], dst.block(block), src.block(block));
+        } else {
+          prolongate_and_add((*transfers_)[to_level], dst, src);
+        }
+      }
+
+      void restrict_and_add(const unsigned int from_level,
+                            VectorType &dst,
+                            const VectorType &src) const override
+      {
+        if constexpr (is_block) {
+          for (unsigned int block = 0; block < src.n_blocks(); ++block)
+            (*transfers_)[from_level].restrict_and_add(dst.block(block),
+                                                       src.block(block));
+        } else {
+          (*transfers_)[from_level].restrict_and_add(dst, src);
+        }
+      }
+
+      /**
+       * Interpolate a (fine) density @p src to all polynomial degrees.
+       */
+      template <typename Number2>
+      void interpolate_to_mg(
+          dealii::MGLevelObject<scalar_type> &dst,
+          const dealii::LinearAlgebra::distributed::Vector<Number2> &src) const
+      {
+        for (unsigned int l = dst.min_level(); l <= dst.max_level(); ++l)
+          if (dst[l].size() == 0)
+            (*level_matrix_free_)[l].initialize_dof_vector(dst[l]);
+
+        copy_locally_owned(dst[dst.max_level()], src);
+        for (unsigned int l = dst.max_level(); l > dst.min_level(); --l)
+          (*transfers_)[l].interpolate(dst[l - 1], dst[l]);
+      }
+
+      template <typename OtherVectorType>
+      void copy_to_mg(const dealii::DoFHandler<dim> & /*dof_handler*/,
+                      dealii::MGLevelObject<VectorType> &dst,
+                      const OtherVectorType &src) const
+      {
+        for (unsigned int l = dst.min_level(); l <= dst.max_level(); ++l) {
+          if constexpr (is_block) {
+            if (dst[l].n_blocks() != src.n_blocks()) {
+              dst[l].reinit(src.n_blocks());
+              for (unsigned int block = 0; block < src.n_blocks(); ++block)
+                (*level_matrix_free_)[l].initialize_dof_vector(
+                    dst[l].block(block));
+              dst[l].collect_sizes();
+            }
+          } else {
+            if (dst[l].size() == 0)
+              (*level_matrix_free_)[l].initialize_dof_vector(dst[l]);
+          }
+          dst[l] = Number(0.);
+        }
+
+        if constexpr (is_block) {
+          for (unsigned int block = 0; block < src.n_blocks(); ++block)
+            copy_locally_owned(dst[dst.max_level()].block(block),
+                               src.block(block));
+        } else {
+          copy_locally_owned(dst[dst.max_level()], src);
+        }
+      }
+
+      template <typename OtherVectorType>
+      void copy_from_mg(const dealii::DoFHandler<dim> & /*dof_handler*/,
+                        OtherVectorType &dst,
+                        const dealii::MGLevelObject<VectorType> &src) const
+      {
+        if constexpr (is_block) {
+          for (unsigned int block = 0; block < dst.n_blocks(); ++block)
+            copy_locally_owned(dst.block(block),
+                               src[src.max_level()].block(block));
+        } else {
+          copy_locally_owned(dst, src[src.max_level()]);
+        }
+      }
+
+    private:
+      const dealii::MGLevelObject<transfer_type> *transfers_;
+      const dealii::MGLevelObject<dealii::MatrixFree<dim, Number>>
+          *level_matrix_free_;
+
+      static void prolongate_and_add(const transfer_type &transfer,
+                                     scalar_type &dst,
+                                     const scalar_type &src)
+      {
+#if DEAL_II_VERSION_GTE(9, 4, 0)
+        transfer.prolongate_and_add(dst, src);
+#else
+        transfer.prolongate(dst, src);
+#endif
+      }
+
+      /* Copy locally owned values, converting between number types: */
+      template <typename Number1, typename Number2>
+      static void copy_locally_owned(
+          dealii::LinearAlgebra::distributed::Vector<Number1> &dst,
+          const dealii::LinearAlgebra::distributed::Vector<Number2> &src)
+      {
+        const unsigned int n_owned =
+            src.get_partitioner()->locally_owned_size();
+        AssertDimension(dst.get_partitioner()->locally_owned_size(), n_owned);
+        DEAL_II_OPENMP_SIMD_PRAGMA
+        for (unsigned int i = 0; i < n_owned; ++i)
+          dst.local_element(i) = Number1(src.local_element(i));
+      }
+    };
+
+
+    /**
+     * A coarse grid solver for the velocity (VectorType is a block vector
+     * with dim blocks) and the internal energy (VectorType is a scalar
+     * vector) multigrid hierarchies. The coarse level operator, i.e.,
+     * the action of VelocityMatrix or EnergyMatrix including the fix up
+     * of boundary degrees of freedom, is assembled into a Trilinos sparse
+     * matrix. The coarse problem is then either approximated by a single
+     * AMG V-cycle or solved with the sparse direct solver Amesos KLU,
+     * which gathers the (small) coarse matrix on a single rank.
+     *
+     * @ingroup ParabolicModule
+     */
+    template <int dim, typename VectorType>
+    class MGCoarseGridAssembled final
+        : public dealii::MGCoarseGridBase<VectorType>
+    {
+    public:
+      static constexpr bool is_velocity =
+          dealii::IsBlockVector<VectorType>::value;
+
+      static constexpr unsigned int n_components = is_velocity ? dim : 1;
+
+      MGCoarseGridAssembled() = default;
+
+      /**
+       * Assemble the level operator on @p level for a given level
+       * @p density and a @p time_factor (theta * tau for the velocity,
+       * theta * tau * c_v^{-1} kappa for the internal energy) and
+       * initialize the coarse solver.
+       */
+      template <typename Number2>
+      void initialize(
+          const ParabolicSystem &parabolic_system,
+          const OfflineData<dim, Number2> &offline_data,
+          const dealii::LinearAlgebra::distributed::Vector<float> &density,
+          const double time_factor,
+          const unsigned int level,
+          const bool use_direct_solver)
+      {
+#ifdef DEAL_II_WITH_TRILINOS
+        using namespace dealii;
+        using size_type = types::global_dof_index;
+
+        use_direct_solver_ = use_direct_solver;
+        level_constraints_ = &offline_data.level_affine_constraints()[level];
+
+        const auto &dof_handler = offline_data.level_dof_handler();
+        const auto &discretization = offline_data.discretization();
+        const auto &mpi_communicator = dof_handler.get_communicator();
+
+        /*
+         * Set up an interleaved numbering (i * n_components + c) and the
+         * sparsity pattern:
+         */
+
+        const IndexSet &owned = dof_handler.locally_owned_mg_dofs(level);
+        IndexSet relevant;
+        DoFTools::extract_locally_relevant_level_dofs(
+            dof_handler, level, relevant);
+
+        const auto interleave = [](const IndexSet &index_set) {
+          IndexSet result(n_components * index_set.size());
+          for (auto it = index_set.begin_intervals();
+               it != index_set.end_intervals();
+               ++it)
+            result.add_range(*it->begin() * n_components,
+                             (it->last() + 1) * n_components);
+          result.compress();
+          return result;
+        };
+
+        const auto owned_interleaved = interleave(owned);
+        const auto relevant_interleaved = interleave(relevant);
+
+        const auto &fe = dof_handler.get_fe();
+        const unsigned int dofs_per_cell = fe.dofs_per_cell;
+        const unsigned int n_local = n_components * dofs_per_cell;
+
+        std::vector<types::global_dof_index> dof_indices(dofs_per_cell);
+        std::vector<size_type> indices(n_local);
+
+        const auto populate_indices = [&](const auto &cell) {
+          cell->get_mg_dof_indices(dof_indices);
+          for (unsigned int j = 0; j < dofs_per_cell; ++j)
+            for (unsigned int c = 0; c < n_components; ++c)
+              indices[j * n_components + c] = dof_indices[j] * n_components + c;
+        };
+
+        /*
+         * Periodicity constraints of the level, translated to the
+         * interleaved numbering:
+         */
+        AffineConstraints<double> constraints(relevant_interleaved);
+        for (const auto &line :
+             offline_data.level_affine_constraints()[level].get_lines())
+          for (unsigned int c = 0; c < n_components; ++c) {
+            constraints.add_line(line.index * n_components + c);
+            for (const auto &[column, weight] : line.entries)
+              constraints.add_entry(line.index * n_components + c,
+                                    column * n_components + c,
+                                    weight);
+          }
+        constraints.close();
+
+        DynamicSparsityPattern dsp(relevant_interleaved);
+        for (const auto &cell : dof_handler.cell_iterators_on_level(level)) {
+          if (!cell->is_locally_owned_on_level())
+            continue;
+          populate_indices(cell);
+          constraints.add_entries_local_to_global(indices, dsp, false);
+        }
+        SparsityTools::distribute_sparsity_pattern(
+            dsp, owned_interleaved, mpi_communicator, relevant_interleaved);
+
+        matrix_.reinit(
+            owned_interleaved, owned_interleaved, dsp, mpi_communicator);
+
+        /* Assemble the stress tensor, or the diffusion operator: */
+
+        const double mu = parabolic_system.mu();
+        const double lambda = parabolic_system.lambda();
+
+        FEValues<dim> fe_values(discretization.mapping(),
+                                fe,
+                                discretization.quadrature(),
+                                update_gradients | update_JxW_values);
+        FullMatrix<double> cell_matrix(n_local, n_local);
+
+        for (const auto &cell : dof_handler.cell_iterators_on_level(level)) {
+          if (!cell->is_locally_owned_on_level())
+            continue;
+
+          fe_values.reinit(cell);
+          cell_matrix = 0.;
+
+          for (unsigned int q = 0; q < fe_values.n_quadrature_points; ++q) {
+            const auto factor_JxW = time_factor * fe_values.JxW(q);
+
+            for (unsigned int i = 0; i < dofs_per_cell; ++i) {
+              const auto grad_i = fe_values.shape_grad(i, q);
+              for (unsigned int j = 0; j < dofs_per_cell; ++j) {
+                const auto grad_j = fe_values.shape_grad(j, q);
+
+                if constexpr (is_velocity) {
+                  /*
+                   * S(phi_j e_d) : nabla^S(phi_i e_c) =
+                   *   mu (delta_cd grad phi_i . grad phi_j
+                   *       + d_c phi_j d_d phi_i)
+                   *   + (lambda - 2/3 mu) d_d phi_j d_c phi_i
+                   */
+                  for (unsigned int c = 0; c < dim; ++c)
+                    for (unsigned int d = 0; d < dim; ++d) {
+                      double value = mu * grad_j[c] * grad_i[d] +
+                                     (lambda - 2. / 3. * mu) * grad_j[d] *
+                                         grad_i[c];
+                      if (c == d)
+                        value += mu * (grad_i * grad_j);
+                      cell_matrix(i * dim + c, j * dim + d) +=
+                          value * factor_JxW;
+                    }
+                } else {
+                  cell_matrix(i, j) += (grad_i * grad_j) * factor_JxW;
+                }
+              }
+            }
+          }
+
+          populate_indices(cell);
+          constraints.distribute_local_to_global(cell_matrix, indices, matrix_);
+        }
+        matrix_.compress(VectorOperation::add);
+
+        /* Add the diagonal m_i rho_i: */
+
+        const auto &lumped_mass_matrix =
+            offline_data.level_lumped_mass_matrix()[level];
+        const unsigned int n_owned = owned.n_elements();
+
+        for (unsigned int k = 0; k < n_owned; ++k) {
+          const auto i = owned.nth_index_in_set(k);
+          const double m_i = lumped_mass_matrix.local_element(k);
+          const double rho_i = density.local_element(k);
+          for (unsigned int c = 0; c < n_components; ++c)
+            matrix_.add(
+                i * n_components + c, i * n_components + c, m_i * rho_i);
+        }
+        matrix_.compress(VectorOperation::add);
+
+        /* Fix up boundary degrees of freedom: */
+
+        std::vector<size_type> identity_rows;
+
+        for (const auto &entry : offline_data.level_boundary_map()[level]) {
+          const auto k = entry.first;
+          if (k >= n_owned)
+            continue;
+
+          const auto i = owned.nth_index_in_set(k);
+          const auto &normal = std::get<0>(entry.second);
+          const auto id = std::get<3>(entry.second);
+
+          if constexpr (is_velocity) {
+            if (id == Boundary::slip) {
+              /* Replace the normal component by the identity: */
+              std::array<std::map<size_type, double>, dim> rows;
+              for (unsigned int e = 0; e < dim; ++e) {
+                const auto row = i * dim + e;
+                for (auto it = matrix_.begin(row); it != matrix_.end(row);
+                     ++it)
+                  rows[e][it->column()] = it->value();
+              }
+
+              for (unsigned int c = 0; c < dim; ++c) {
+                std::map<size_type, double> result;
+                for (unsigned int e = 0; e < dim; ++e) {
+                  const double factor =
+                      (c == e ? 1. : 0.) - double(normal[c] * normal[e]);
+                  for (const auto &[column, value] : rows[e])
+                    result[column] += factor * value;
+                  result[i * dim + e] += double(normal[c] * normal[e]);
+                }
+
+                std::vector<size_type> columns;
+                std::vector<double> values;
+                for (const auto &[column, value] : result) {
+                  columns.push_back(column);
+                  values.push_back(value);
+                }
+                matrix_.set(i * dim + c,
+                            columns.size(),
+                            columns.data(),
+                            values.data());
+              }
+
+            } else if (id == Boundary::no_slip || id == Boundary::dirichlet) {
+              for (unsigned int c = 0; c < dim; ++c)
+                identity_rows.push_back(i * dim + c);
+            }
+
+          } else {
+            if (id == Boundary::dirichlet)
+              identity_rows.push_back(i);
+          }
+        }
+        matrix_.compress(VectorOperation::insert);
+        matrix_.clear_rows(identity_rows, 1.);
+
+        /* Initialize the coarse solver: */
+
+        if (use_direct_solver_) {
+          direct_solver_ =
+              std::make_unique<TrilinosWrappers::SolverDirect>(solver_control_);
+          direct_solver_->initialize(matrix_);
+        } else {
+          TrilinosWrappers::PreconditionAMG::AdditionalData data;
+          data.elliptic = true;
+          data.n_cycles = 1;
+          data.smoother_sweeps = 2;
+          data.aggregation_threshold = 0.02;
+          amg_.initialize(matrix_, data);
+        }
+
+        src_.reinit(owned_interleaved, mpi_communicator);
+        dst_.reinit(owned_interleaved, mpi_communicator);
+#else
+        (void)parabolic_system;
+        (void)offline_data;
+        (void)density;
+        (void)time_factor;
+        (void)level;
+        (void)use_direct_solver;
+        AssertThrow(false,
+                    dealii::ExcMessage("The assembled coarse grid solver "
+                                       "requires deal.II with Trilinos."));
+#endif
+      }
+
+      void operator()(const unsigned int /*level*/,
+                      VectorType &dst,
+                      const VectorType &src) const override
+      {
+#ifdef DEAL_II_WITH_TRILINOS
+        const auto component = [](auto &vector,
+                                  const unsigned int c) -> auto & {
+          if constexpr (is_velocity)
+            return vector.block(c);
+          else
+            return vector;
+        };
+
+        const unsigned int n_owned =
+            component(src, 0).get_partitioner()->locally_owned_size();
+
+        auto src_ptr = src_.begin();
+        for (unsigned int k = 0; k < n_owned; ++k)
+          for (unsigned int c = 0; c < n_components; ++c)
+            *src_ptr++ = component(src, c).local_element(k);
+
+        if (use_direct_solver_)
+          direct_solver_->solve(dst_, src_);
+        else
+          amg_.vmult(dst_, src_);
+
+        auto dst_ptr = dst_.begin();
+        for (unsigned int k = 0; k < n_owned; ++k)
+          for (unsigned int c = 0; c < n_components; ++c)
+            component(dst, c).local_element(k) = *dst_ptr++;
+
+        /* Periodically constrained entries are unused, see compute_diagonal: */
+        for (unsigned int c = 0; c < n_components; ++c)
+          level_constraints_->set_zero(component(dst, c));
+#else
+        (void)dst;
+        (void)src;
+        __builtin_trap();
+#endif
+      }
+
+      std::size_t memory_consumption() const
+      {
+#ifdef DEAL_II_WITH_TRILINOS
+        return matrix_.memory_consumption();
+#else
+        return 0;
+#endif
+      }
+
+    private:
+#ifdef DEAL_II_WITH_TRILINOS
+      dealii::TrilinosWrappers::SparseMatrix matrix_;
+      dealii::TrilinosWrappers::PreconditionAMG amg_;
+      dealii::SolverControl solver_control_;
+      std::unique_ptr<dealii::TrilinosWrappers::SolverDirect> direct_solver_;
+      mutable dealii::TrilinosWrappers::MPI::Vector src_;
+      mutable dealii::TrilinosWrappers::MPI::Vector dst_;
+#endif
+      const dealii::AffineConstraints<float> *level_constraints_ = nullptr;
+      bool use_direct_solver_ = false;
+    };
+
   } // namespace NavierStokes
 } /* namespace ryujin */
 
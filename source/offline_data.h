@@ -21,6 +21,9 @@
 
 #include <deal.II/numerics/data_out.h>
 
+#include <map>
+#include <string>
+
 namespace ryujin
 {
   /**
@@ -86,6 +89,14 @@ namespace ryujin
       create_multigrid_data();
     }
 
+    /**
+     * Record the memory consumption (in bytes) of the assembled matrices,
+     * the sparsity patterns, the boundary maps and the multigrid level
+     * data in @p statistics.
+     */
+    void
+    memory_statistics(std::map<std::string, std::size_t> &statistics) const;
+
     /**
      * The DofHandler for our (scalar) CG ansatz space in (deal.II typical)
      * global numbering.
@@ -168,12 +179,61 @@ namespace ryujin
      */
     ACCESSOR_READ_ONLY(coupling_boundary_pairs)
 
+    /**
+     * The DoFHandler with polynomial degree @p degree on the active mesh
+     * that is used for the p-multigrid hierarchy, where @p degree ranges
+     * from 1 to Discretization::order_finite_element. For the latter the
+     * function returns dof_handler().
+     */
+    const dealii::DoFHandler<dim> &
+    p_level_dof_handler(const unsigned int degree) const
+    {
+      constexpr auto order = Discretization<dim>::order_finite_element;
+      Assert(degree >= 1 && degree <= order,
+             dealii::ExcIndexRange(degree, 1, order + 1));
+      return degree == order ? *dof_handler_ : *p_level_dof_handler_[degree];
+    }
+
+    /**
+     * The DoFHandler for which the multigrid level data (level boundary
+     * maps, level affine constraints, and level lumped mass matrices) is
+     * created. For higher order elements this is the Q1 space at the
+     * bottom of the p-multigrid hierarchy, p_level_dof_handler(1),
+     * otherwise it is dof_handler().
+     */
+    const dealii::DoFHandler<dim> &level_dof_handler() const
+    {
+      return p_level_dof_handler(1);
+    }
+
     /**
      * The boundary map on all levels of the grid in case multilevel
      * support was enabled.
      */
     ACCESSOR_READ_ONLY(level_boundary_map)
 
+    /**
+     * The affine constraints on all levels of the grid in case multilevel
+     * support was enabled. These only contain the identification of
+     * degrees of freedom on periodic faces. Global level numbering.
+     */
+    ACCESSOR_READ_ONLY(level_affine_constraints)
+
+    /**
+     * The boundary map for all polynomial degrees of the p-multigrid
+     * hierarchy, indexed by the polynomial degree. Only populated for
+     * Discretization::order_finite_element > 1.
+     */
+    ACCESSOR_READ_ONLY(p_level_boundary_map)
+
+    /**
+     * The affine constraints (hanging nodes and periodicity) for all
+     * polynomial degrees of the p-multigrid hierarchy, indexed by the
+     * polynomial degree. Global numbering. Only populated for
+     * Discretization::order_finite_element > 1.
+     */
+    ACCESSOR_READ_ONLY(p_level_affine_constraints)
+
     /**
      * A sparsity pattern for (standard deal.II) matrices storing indices
      * in (Deal.II typical) global numbering.
@@ -207,6 +267,13 @@ namespace ryujin
      */
     ACCESSOR_READ_ONLY(level_lumped_mass_matrix)
 
+    /**
+     * The lumped mass matrix for all polynomial degrees of the
+     * p-multigrid hierarchy, indexed by the polynomial degree. Only
+     * populated for Discretization::order_finite_element > 1.
+     */
+    ACCESSOR_READ_ONLY(p_level_lumped_mass_matrix)
+
     /**
      * The stiffness matrix \f$(beta_{ij})\f$:
      *   \f$\beta_{ij} = \nabla\varphi_{j}\cdot\nabla\varphi_{i}\f$
@@ -255,6 +322,21 @@ namespace ryujin
      */
     void create_multigrid_data();
 
+    /**
+     * Create the DoFHandlers and data of the p-multigrid hierarchy.
+     * Internally used in create_multigrid_data().
+     */
+    void create_p_multigrid_data();
+
+    /**
+     * Add periodicity constraints for @p dof_handler to
+     * @p affine_constraints.
+     */
+    void
+    enforce_periodicity(const dealii::DoFHandler<dim> &dof_handler,
+                        dealii::AffineConstraints<Number> &affine_constraints)
+        const;
+
     std::unique_ptr<dealii::DoFHandler<dim>> dof_handler_;
 
     dealii::AffineConstraints<Number> affine_constraints_;
@@ -281,6 +363,14 @@ namespace ryujin
 
     std::vector<boundary_map_type> level_boundary_map_;
 
+    std::vector<dealii::AffineConstraints<float>> level_affine_constraints_;
+
+    std::vector<std::unique_ptr<dealii::DoFHandler<dim>>> p_level_dof_handler_;
+    std::vector<boundary_map_type> p_level_boundary_map_;
+    std::vector<dealii::AffineConstraints<float>> p_level_affine_constraints_;
+    std::vector<dealii::LinearAlgebra::distributed::Vector<float>>
+        p_level_lumped_mass_matrix_;
+
     dealii::DynamicSparsityPattern sparsity_pattern_;
 
     SparsityPatternSIMD<dealii::VectorizedArray<Number>::size()>
@@ -305,13 +395,35 @@ namespace ryujin
     const MPI_Comm &mpi_communicator_;
 
     /**
-     * Construct a boundary map for a given set of DoFHandler iterators.
+     * Construct a boundary map for a given set of DoFHandler iterators
+     * with finite element @p finite_element.
+     * Constrained degrees of freedom are skipped: If @p level_constraints
+     * is given they are taken from the (globally indexed) level
+     * constraints, otherwise from the sparsity pattern of the active
+     * level.
      */
     template <typename ITERATOR1, typename ITERATOR2>
     boundary_map_type construct_boundary_map(
+        const dealii::FiniteElement<dim> &finite_element,
+        const ITERATOR1 &begin,
+        const ITERATOR2 &end,
+        const dealii::Utilities::MPI::Partitioner &partitioner,
+        const dealii::AffineConstraints<float> *level_constraints =
+            nullptr) const;
+
+    /**
+     * Assemble the lumped mass matrix for a given set of DoFHandler
+     * iterators with finite element @p finite_element into
+     * @p lumped_mass_matrix, distributing with @p constraints.
+     */
+    template <typename ITERATOR1, typename ITERATOR2>
+    void assemble_lumped_mass_matrix(
+        const dealii::FiniteElement<dim> &finite_element,
         const ITERATOR1 &begin,
         const ITERATOR2 &end,
-        const dealii::Utilities::MPI::Partitioner &partitioner) const;
+        const dealii::AffineConstraints<float> &constraints,
+        dealii::LinearAlgebra::distributed::Vector<float> &lumped_mass_matrix)
+        const;
   };
 
 } /* namespace ryujin */
@@ -13,13 +13,16 @@
 
 #include <deal.II/base/graph_coloring.h>
 #include <deal.II/base/parallel.h>
+#include <deal.II/base/thread_management.h>
 #include <deal.II/base/work_stream.h>
 #include <deal.II/dofs/dof_renumbering.h>
 #include <deal.II/dofs/dof_tools.h>
+#include <deal.II/fe/fe_q.h>
 #include <deal.II/fe/fe_values.h>
 #include <deal.II/grid/grid_tools.h>
 #include <deal.II/lac/dynamic_sparsity_pattern.h>
 #include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/multigrid/mg_constrained_dofs.h>
 #ifdef DEAL_II_WITH_TRILINOS
 #include <deal.II/lac/trilinos_sparse_matrix.h>
 #endif
@@ -69,6 +72,42 @@ namespace ryujin
                            "hanging node support available"));
 #endif
 
+    enforce_periodicity(dof_handler, affine_constraints_);
+
+    affine_constraints_.close();
+
+    sparsity_pattern_.reinit(
+        dof_handler.n_dofs(), dof_handler.n_dofs(), locally_relevant);
+#ifdef DEAL_II_WITH_TRILINOS
+    DoFTools::make_sparsity_pattern(
+        dof_handler, sparsity_pattern_, affine_constraints_, false);
+#else
+    /*
+     * In case we use dealii::SparseMatrix<Number> for assembly we need a
+     * sparsity pattern that also includes the full locally relevant -
+     * locally relevant coupling block. This gets thrown out again later,
+     * but nevertheless we have to add it.
+     */
+    DoFTools::make_extended_sparsity_pattern(
+        dof_handler, sparsity_pattern_, affine_constraints_, false);
+#endif
+
+    /*
+     * We have to complete the local stencil to have consistent size over
+     * all MPI ranks. Otherwise, MPI synchronization in our
+     * SparseMatrixSIMD class will fail.
+     */
+
+    SparsityTools::distribute_sparsity_pattern(
+        sparsity_pattern_, locally_owned, mpi_communicator_, locally_relevant);
+  }
+
+
+  template <int dim, typename Number>
+  void OfflineData<dim, Number>::enforce_periodicity(
+      const DoFHandler<dim> &dof_handler,
+      AffineConstraints<Number> &affine_constraints) const
+  {
     /*
      * Enforce periodic boundary conditions. We assume that the mesh is in
      * "normal configuration".
@@ -96,7 +135,7 @@ namespace ryujin
         DoFTools::make_periodicity_constraints(
             dof_cell_left->face(left.second),
             dof_cell_right->face(right.second),
-            affine_constraints_,
+            affine_constraints,
             ComponentMask(),
             /* orientation */ orientation[0],
             /* flip */ orientation[1],
@@ -106,33 +145,6 @@ namespace ryujin
         __builtin_trap();
       }
     }
-
-    affine_constraints_.close();
-
-    sparsity_pattern_.reinit(
-        dof_handler.n_dofs(), dof_handler.n_dofs(), locally_relevant);
-#ifdef DEAL_II_WITH_TRILINOS
-    DoFTools::make_sparsity_pattern(
-        dof_handler, sparsity_pattern_, affine_constraints_, false);
-#else
-    /*
-     * In case we use dealii::SparseMatrix<Number> for assembly we need a
-     * sparsity pattern that also includes the full locally relevant -
-     * locally relevant coupling block. This gets thrown out again later,
-     * but nevertheless we have to add it.
-     */
-    DoFTools::make_extended_sparsity_pattern(
-        dof_handler, sparsity_pattern_, affine_constraints_, false);
-#endif
-
-    /*
-     * We have to complete the local stencil to have consistent size over
-     * all MPI ranks. Otherwise, MPI synchronization in our
-     * SparseMatrixSIMD class will fail.
-     */
-
-    SparsityTools::distribute_sparsity_pattern(
-        sparsity_pattern_, locally_owned, mpi_communicator_, locally_relevant);
   }
 
 
@@ -609,8 +621,10 @@ namespace ryujin
 
     /* Populate boundary map: */
 
-    boundary_map_ = construct_boundary_map(
-        dof_handler.begin_active(), dof_handler.end(), *scalar_partitioner_);
+    boundary_map_ = construct_boundary_map(discretization_->finite_element(),
+                                           dof_handler.begin_active(),
+                                           dof_handler.end(),
+                                           *scalar_partitioner_);
 
     /* Extract coupling boundary pairs: */
 
@@ -644,58 +658,218 @@ namespace ryujin
               << std::endl;
 #endif
 
-    auto &dof_handler = *dof_handler_;
+    /*
+     * For higher order elements the level data is created for the Q1
+     * space at the bottom of the p-multigrid hierarchy:
+     */
+
+    create_p_multigrid_data();
+
+    constexpr auto order = Discretization<dim>::order_finite_element;
+    auto &dof_handler = order > 1 ? *p_level_dof_handler_[1] : *dof_handler_;
 
     dof_handler.distribute_mg_dofs();
 
     const auto n_levels = dof_handler.get_triangulation().n_global_levels();
 
-    AffineConstraints<float> level_constraints;
-    // TODO not yet thread-parallel and without periodicity
+    /*
+     * Set up level constraints: MGConstrainedDoFs identifies degrees of
+     * freedom on periodic faces of the same level. We only keep these
+     * periodicity constraints; boundary conditions are handled via the
+     * level boundary maps.
+     */
+
+    MGLevelObject<IndexSet> relevant_sets(0, n_levels - 1);
+    for (unsigned int level = 0; level < n_levels; ++level)
+      dealii::DoFTools::extract_locally_relevant_level_dofs(
+          dof_handler, level, relevant_sets[level]);
+
+    MGConstrainedDoFs mg_constrained_dofs;
+    mg_constrained_dofs.initialize(dof_handler, relevant_sets);
 
+    level_affine_constraints_.resize(n_levels);
     level_boundary_map_.resize(n_levels);
     level_lumped_mass_matrix_.resize(n_levels);
 
+    std::vector<std::shared_ptr<const Utilities::MPI::Partitioner>>
+        partitioners(n_levels);
+
     for (unsigned int level = 0; level < n_levels; ++level) {
-      /* Assemble lumped mass matrix vector: */
+      level_affine_constraints_[level].copy_from(
+          mg_constrained_dofs.get_level_constraints(level));
 
-      IndexSet relevant_dofs;
-      dealii::DoFTools::extract_locally_relevant_level_dofs(
-          dof_handler, level, relevant_dofs);
-      const auto partitioner = std::make_shared<Utilities::MPI::Partitioner>(
+      partitioners[level] = std::make_shared<Utilities::MPI::Partitioner>(
           dof_handler.locally_owned_mg_dofs(level),
-          relevant_dofs,
+          relevant_sets[level],
           lumped_mass_matrix_.get_mpi_communicator());
-      level_lumped_mass_matrix_[level].reinit(partitioner);
-      std::vector<types::global_dof_index> dof_indices(
-          dof_handler.get_fe().dofs_per_cell);
-      Vector<Number> mass_values(dof_handler.get_fe().dofs_per_cell);
-      FEValues<dim> fe_values(discretization_->mapping(),
-                              discretization_->finite_element(),
-                              discretization_->quadrature(),
-                              update_values | update_JxW_values);
-      for (const auto &cell : dof_handler.cell_iterators_on_level(level))
-        // TODO for assembly with dealii::SparseMatrix and local
-        // numbering this probably has to read !cell->is_artificial()
-        if (cell->is_locally_owned_on_level()) {
+    }
+
+    /*
+     * Populate boundary maps: The construction is local to each MPI rank,
+     * so we create one task per level that runs concurrently with the
+     * assembly of the lumped mass matrices below.
+     */
+
+    const auto &finite_element = dof_handler.get_fe();
+
+    Threads::TaskGroup<> tasks;
+    for (unsigned int level = 0; level < n_levels; ++level)
+      tasks += Threads::new_task(
+          [this, &finite_element, &dof_handler, &partitioners, level]() {
+            level_boundary_map_[level] =
+                construct_boundary_map(finite_element,
+                                       dof_handler.begin_mg(level),
+                                       dof_handler.end_mg(level),
+                                       *partitioners[level],
+                                       &level_affine_constraints_[level]);
+          });
+
+    /*
+     * Assemble lumped mass matrix vectors:
+     */
+
+    for (unsigned int level = 0; level < n_levels; ++level) {
+      level_lumped_mass_matrix_[level].reinit(partitioners[level]);
+      assemble_lumped_mass_matrix(finite_element,
+                                  dof_handler.begin_mg(level),
+                                  dof_handler.end_mg(level),
+                                  level_affine_constraints_[level],
+                                  level_lumped_mass_matrix_[level]);
+    }
+
+    tasks.join_all();
+  }
+
+
+  template <int dim, typename Number>
+  void OfflineData<dim, Number>::create_p_multigrid_data()
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "OfflineData<dim, Number>::create_p_multigrid_data()"
+              << std::endl;
+#endif
+
+    constexpr auto order = Discretization<dim>::order_finite_element;
+
+    if (order == 1) {
+      p_level_dof_handler_.clear();
+      p_level_affine_constraints_.clear();
+      p_level_boundary_map_.clear();
+      p_level_lumped_mass_matrix_.clear();
+      return;
+    }
+
+    /*
+     * Set up the spaces of polynomial degree 1, ..., order - 1 on the
+     * active mesh. All p-level data is indexed by the polynomial degree;
+     * the degree order is the finite element space of dof_handler_.
+     */
+
+    p_level_dof_handler_.resize(order);
+    p_level_affine_constraints_.resize(order + 1);
+    p_level_boundary_map_.resize(order + 1);
+    p_level_lumped_mass_matrix_.resize(order + 1);
+
+    const auto &triangulation = discretization_->triangulation();
+
+    for (unsigned int degree = 1; degree <= order; ++degree) {
+      if (degree < order) {
+        auto &p_dof_handler = p_level_dof_handler_[degree];
+        if (!p_dof_handler)
+          p_dof_handler = std::make_unique<DoFHandler<dim>>(triangulation);
+        p_dof_handler->distribute_dofs(FE_Q<dim>(degree));
+        DoFRenumbering::Cuthill_McKee(*p_dof_handler);
+      }
+
+      const auto &dof_handler = p_level_dof_handler(degree);
+
+      IndexSet locally_relevant;
+      DoFTools::extract_locally_relevant_dofs(dof_handler, locally_relevant);
+
+      AffineConstraints<Number> affine_constraints(locally_relevant);
+      DoFTools::make_hanging_node_constraints(dof_handler, affine_constraints);
+      enforce_periodicity(dof_handler, affine_constraints);
+      affine_constraints.close();
+      p_level_affine_constraints_[degree].copy_from(affine_constraints);
+
+      const auto partitioner = std::make_shared<Utilities::MPI::Partitioner>(
+          dof_handler.locally_owned_dofs(),
+          locally_relevant,
+          mpi_communicator_);
+
+      p_level_boundary_map_[degree] =
+          construct_boundary_map(dof_handler.get_fe(),
+                                 dof_handler.begin_active(),
+                                 dof_handler.end(),
+                                 *partitioner,
+                                 &p_level_affine_constraints_[degree]);
+
+      p_level_lumped_mass_matrix_[degree].reinit(partitioner);
+      assemble_lumped_mass_matrix(dof_handler.get_fe(),
+                                  dof_handler.begin_active(),
+                                  dof_handler.end(),
+                                  p_level_affine_constraints_[degree],
+                                  p_level_lumped_mass_matrix_[degree]);
+    }
+  }
+
+
+  template <int dim, typename Number>
+  template <typename ITERATOR1, typename ITERATOR2>
+  void OfflineData<dim, Number>::assemble_lumped_mass_matrix(
+      const FiniteElement<dim> &finite_element,
+      const ITERATOR1 &begin,
+      const ITERATOR2 &end,
+      const AffineConstraints<float> &constraints,
+      LinearAlgebra::distributed::Vector<float> &lumped_mass_matrix) const
+  {
+    const unsigned int dofs_per_cell = finite_element.dofs_per_cell;
+    const unsigned int n_q_points = discretization_->quadrature().size();
+
+    const auto local_assemble_system =
+        [&](const auto &cell, auto &scratch, auto &copy) {
+          auto &is_locally_owned = copy.is_locally_owned_;
+          auto &local_dof_indices = copy.local_dof_indices_;
+          auto &cell_lumped_mass = copy.cell_lumped_mass_;
+
+          auto &fe_values = scratch.fe_values_;
+
+          // TODO for assembly with dealii::SparseMatrix and local
+          // numbering this probably has to read !cell->is_artificial()
+          is_locally_owned = cell->is_locally_owned_on_level();
+          if (!is_locally_owned)
+            return;
+
           fe_values.reinit(cell);
-          for (unsigned int i = 0; i < mass_values.size(); ++i) {
+
+          local_dof_indices.resize(dofs_per_cell);
+          cell->get_active_or_mg_dof_indices(local_dof_indices);
+
+          cell_lumped_mass.reinit(dofs_per_cell);
+          for (unsigned int i = 0; i < dofs_per_cell; ++i) {
             double sum = 0;
-            for (unsigned int q = 0; q < fe_values.n_quadrature_points; ++q)
+            for (unsigned int q = 0; q < n_q_points; ++q)
               sum += fe_values.shape_value(i, q) * fe_values.JxW(q);
-            mass_values(i) = sum;
+            cell_lumped_mass(i) = sum;
           }
-          cell->get_mg_dof_indices(dof_indices);
-          level_constraints.distribute_local_to_global(
-              mass_values, dof_indices, level_lumped_mass_matrix_[level]);
-        }
-      level_lumped_mass_matrix_[level].compress(VectorOperation::add);
+        };
 
-      /* Populate boundary map: */
+    const auto copy_local_to_global = [&](const auto &copy) {
+      if (!copy.is_locally_owned_)
+        return;
 
-      level_boundary_map_[level] = construct_boundary_map(
-          dof_handler.begin_mg(level), dof_handler.end_mg(level), *partitioner);
-    }
+      constraints.distribute_local_to_global(
+          copy.cell_lumped_mass_, copy.local_dof_indices_, lumped_mass_matrix);
+    };
+
+    WorkStream::run(begin,
+                    end,
+                    local_assemble_system,
+                    copy_local_to_global,
+                    AssemblyScratchData<dim>(*discretization_, finite_element),
+                    LevelAssemblyCopyData<Number>());
+
+    lumped_mass_matrix.compress(VectorOperation::add);
   }
 
 
@@ -703,41 +877,52 @@ namespace ryujin
   template <typename ITERATOR1, typename ITERATOR2>
   typename OfflineData<dim, Number>::boundary_map_type
   OfflineData<dim, Number>::construct_boundary_map(
+      const FiniteElement<dim> &finite_element,
       const ITERATOR1 &begin,
       const ITERATOR2 &end,
-      const Utilities::MPI::Partitioner &partitioner) const
+      const Utilities::MPI::Partitioner &partitioner,
+      const AffineConstraints<float> *level_constraints) const
   {
 #ifdef DEBUG_OUTPUT
     std::cout << "OfflineData<dim, Number>::construct_boundary_map()"
               << std::endl;
 #endif
 
-    decltype(boundary_map_) preliminary_map;
-
-    std::vector<dealii::types::global_dof_index> local_dof_indices;
+    using entry_type =
+        std::pair<dealii::types::global_dof_index, boundary_description>;
 
-    const dealii::QGauss<dim - 1> face_quadrature(3);
-    dealii::FEFaceValues<dim> fe_face_values(discretization_->mapping(),
-                                             discretization_->finite_element(),
-                                             face_quadrature,
-                                             dealii::update_normal_vectors |
-                                                 dealii::update_values |
-                                                 dealii::update_JxW_values);
+    const unsigned int dofs_per_cell = finite_element.dofs_per_cell;
 
-    const unsigned int dofs_per_cell =
-        discretization_->finite_element().dofs_per_cell;
+    const auto support_points = finite_element.get_unit_support_points();
 
-    const auto support_points =
-        discretization_->finite_element().get_unit_support_points();
+    /*
+     * Collect all boundary contributions of a cell. Cells without
+     * boundary faces are skipped before querying dof indices, the face
+     * values are only evaluated for faces that carry at least one locally
+     * owned, unconstrained degree of freedom, and the (expensive) mapping
+     * of support points is done at most once per cell and degree of
+     * freedom.
+     */
+    const auto local_assemble_system = [&](const auto &cell,
+                                           auto &scratch,
+                                           auto &copy) {
+      auto &entries = copy.entries_;
+      entries.clear();
 
-    for (auto cell = begin; cell != end; ++cell) {
+      if (!cell->is_locally_owned_on_level() || !cell->at_boundary())
+        return;
 
-      if (!cell->is_locally_owned_on_level())
-        continue;
+      auto &fe_face_values = scratch.fe_face_values_;
+      auto &local_dof_indices = scratch.local_dof_indices_;
+      auto &positions = scratch.positions_;
+      auto &position_computed = scratch.position_computed_;
 
       local_dof_indices.resize(dofs_per_cell);
       cell->get_active_or_mg_dof_indices(local_dof_indices);
 
+      positions.resize(dofs_per_cell);
+      position_computed.assign(dofs_per_cell, false);
+
       for (auto f : GeometryInfo<dim>::face_indices()) {
         const auto face = cell->face(f);
         const auto id = face->boundary_id();
@@ -753,14 +938,37 @@ namespace ryujin
         if (id == Boundary::periodic)
           continue;
 
-        fe_face_values.reinit(cell, f);
-        const unsigned int n_face_q_points = face_quadrature.size();
+        bool face_values_initialized = false;
+        const unsigned int n_face_q_points = scratch.face_quadrature_.size();
 
         for (unsigned int j = 0; j < dofs_per_cell; ++j) {
 
-          if (!discretization_->finite_element().has_support_on_face(j, f))
+          if (!finite_element.has_support_on_face(j, f))
+            continue;
+
+          const auto global_index = local_dof_indices[j];
+          const auto index = partitioner.global_to_local(global_index);
+
+          /* Skip nonlocal degrees of freedom: */
+          if (index >= partitioner.locally_owned_size())
             continue;
 
+          /* Skip constrained degrees of freedom: */
+          if (level_constraints != nullptr) {
+            if (level_constraints->is_constrained(global_index))
+              continue;
+          } else {
+            const unsigned int row_length =
+                sparsity_pattern_simd_.row_length(index);
+            if (row_length == 1)
+              continue;
+          }
+
+          if (!face_values_initialized) {
+            fe_face_values.reinit(cell, f);
+            face_values_initialized = true;
+          }
+
           Number boundary_mass = 0.;
           dealii::Tensor<1, dim, Number> normal;
 
@@ -772,32 +980,49 @@ namespace ryujin
             normal += phi_i * fe_face_values.normal_vector(q) * JxW;
           }
 
-          const auto global_index = local_dof_indices[j];
-          const auto index = partitioner.global_to_local(global_index);
-
-          /* Skip nonlocal degrees of freedom: */
-          if (index >= n_locally_owned_)
-            continue;
-
-          /* Skip constrained degrees of freedom: */
-          const unsigned int row_length =
-              sparsity_pattern_simd_.row_length(index);
-          if (row_length == 1)
-            continue;
-
-          Point<dim> position =
-              discretization_->mapping().transform_unit_to_real_cell(
-                  cell, support_points[j]);
+          if (!position_computed[j]) {
+            positions[j] =
+                discretization_->mapping().transform_unit_to_real_cell(
+                    cell, support_points[j]);
+            position_computed[j] = true;
+          }
 
           /*
            * Temporarily insert a (wrong) boundary mass value for the
            * normal mass. We'll fix this later.
            */
-          preliminary_map.insert(
-              {index, {normal, boundary_mass, boundary_mass, id, position}});
+          entries.push_back(
+              {index,
+               {normal, boundary_mass, boundary_mass, id, positions[j]}});
         } /* j */
       }   /* f */
-    }     /* cell */
+    };
+
+    /*
+     * WorkStream calls the copier in the order of the cell iterators.
+     * Together with the stable sort below this reproduces the order of
+     * contributions (and thus the floating point summation order in the
+     * filter step) of a serial loop over all cells.
+     */
+    std::vector<entry_type> preliminary_entries;
+
+    const auto copy_local_to_global = [&](const auto &copy) {
+      preliminary_entries.insert(preliminary_entries.end(),
+                                 copy.entries_.begin(),
+                                 copy.entries_.end());
+    };
+
+    WorkStream::run(begin,
+                    end,
+                    local_assemble_system,
+                    copy_local_to_global,
+                    BoundaryScratchData<dim>(*discretization_, finite_element),
+                    BoundaryCopyData<entry_type>());
+
+    std::stable_sort(
+        preliminary_entries.begin(),
+        preliminary_entries.end(),
+        [](const auto &a, const auto &b) { return a.first < b.first; });
 
     /*
      * Filter boundary map:
@@ -811,8 +1036,7 @@ namespace ryujin
      */
 
     decltype(boundary_map_) filtered_map;
-    std::set<dealii::types::global_dof_index> boundary_dofs;
-    for (auto entry : preliminary_map) {
+    for (const auto &entry : preliminary_entries) {
       bool inserted = false;
       const auto range = filtered_map.equal_range(entry.first);
       for (auto it = range.first; it != range.second; ++it) {
@@ -835,8 +1059,9 @@ namespace ryujin
           inserted = true;
         }
       }
+      /* Keys are sorted, so every new entry goes to the end: */
       if (!inserted)
-        filtered_map.insert(entry);
+        filtered_map.insert(filtered_map.end(), entry);
     }
 
     /* Normalize all normal vectors: */
@@ -853,4 +1078,50 @@ namespace ryujin
     return filtered_map;
   }
 
+
+  template <int dim, typename Number>
+  void OfflineData<dim, Number>::memory_statistics(
+      std::map<std::string, std::size_t> &statistics) const
+  {
+    using dealii::MemoryConsumption::memory_consumption;
+
+    /*
+     * Estimate the size of a node of a std::multimap by the size of its
+     * value type plus a color field and three pointers:
+     */
+    const auto map_consumption = [](const boundary_map_type &map) {
+      return map.size() * (sizeof(typename boundary_map_type::value_type) +
+                           4 * sizeof(void *));
+    };
+
+    statistics["OfflineData - dof handler"] =
+        dof_handler_->memory_consumption();
+    statistics["OfflineData - affine constraints"] =
+        affine_constraints_.memory_consumption();
+    statistics["OfflineData - sparsity patterns"] =
+        sparsity_pattern_.memory_consumption() +
+        sparsity_pattern_simd_.memory_consumption();
+    statistics["OfflineData - mass matrix"] =
+        mass_matrix_.memory_consumption() +
+        lumped_mass_matrix_.memory_consumption() +
+        lumped_mass_matrix_inverse_.memory_consumption();
+    statistics["OfflineData - betaij matrix"] =
+        betaij_matrix_.memory_consumption();
+    statistics["OfflineData - cij matrix"] = cij_matrix_.memory_consumption();
+    statistics["OfflineData - boundary map"] =
+        map_consumption(boundary_map_) +
+        memory_consumption(coupling_boundary_pairs_);
+
+    std::size_t level_data = memory_consumption(level_lumped_mass_matrix_) +
+                             memory_consumption(p_level_lumped_mass_matrix_);
+    for (const auto &map : level_boundary_map_)
+      level_data += map_consumption(map);
+    for (const auto &map : p_level_boundary_map_)
+      level_data += map_consumption(map);
+    for (const auto &p_dof_handler : p_level_dof_handler_)
+      if (p_dof_handler)
+        level_data += p_dof_handler->memory_consumption();
+    statistics["OfflineData - level data"] = level_data;
+  }
+
 } /* namespace ryujin */
@@ -8,6 +8,7 @@
 #include <compile_time_options.h>
 
 #include <deal.II/base/config.h>
+#include <deal.II/base/exceptions.h>
 
 #ifdef WITH_OPENMP
 #include <omp.h>
@@ -99,6 +100,23 @@
  */
 #define RYUJIN_OMP_SINGLE RYUJIN_PRAGMA(omp single)
 
+/**
+ * Annotate a section that has to be executed on one thread only, without
+ * an implicit thread synchronization barrier at the end of the section.
+ *
+ * @ingroup Miscellaneous
+ */
+#define RYUJIN_OMP_SINGLE_NOWAIT RYUJIN_PRAGMA(omp single nowait)
+
+/**
+ * Annotate a section that has to be executed on the master thread only.
+ * In contrast to RYUJIN_OMP_SINGLE there is no implied barrier at the end
+ * of the section.
+ *
+ * @ingroup Miscellaneous
+ */
+#define RYUJIN_OMP_MASTER RYUJIN_PRAGMA(omp master)
+
 /**
  * Compiler hint annotating a boolean to be likely true.
  *
@@ -134,7 +152,23 @@
 namespace ryujin
 {
   /**
-   * @todo write documentation
+   * A helper class that dispatches an asynchronous payload (typically
+   * the start of an MPI ghost exchange) as soon as all threads of a
+   * parallel region have signalled that their share of the data is ready.
+   *
+   * Every thread calls check() with a thread-local flag and a condition
+   * (for example "the export indices have been processed"). The last
+   * thread that fulfills the condition launches the payload with
+   * std::async. A call to finalize() then waits for the payload to
+   * complete, or executes it synchronously if it has not been launched
+   * (for example because WITH_ASYNC_MPI_EXCHANGE is not defined).
+   *
+   * An object can be reused for several rounds within one parallel
+   * region: finalize() resets the object, and launching the payload
+   * marks the object as in flight again. discard() ends a round that
+   * never called check() without executing the payload. The destructor
+   * waits for a payload that is still in flight and executes the payload
+   * if no round has been finalized or discarded.
    *
    * @ingroup Miscellaneous
    */
@@ -144,6 +178,7 @@ namespace ryujin
     SynchronizationDispatch(const std::function<void()> &async_payload)
         : async_payload_(async_payload)
         , n_threads_ready_(0)
+        , finalized_(false)
     {
     }
 
@@ -151,11 +186,40 @@ namespace ryujin
     {
       /* Executes in serial, non thread-parallel context: */
 
+      if (payload_status_.valid() || !finalized_)
+        finalize();
+    }
+
+    /**
+     * Wait for the asynchronous payload to complete, or execute the
+     * payload if it has not been dispatched yet. Afterwards, the object is
+     * reset so that it can be reused for another round of check() calls.
+     *
+     * The function must be called from a serial context, or from within a
+     * RYUJIN_OMP_SINGLE section of a persistent parallel region.
+     */
+    void finalize()
+    {
       if (payload_status_.valid()) {
         payload_status_.wait();
       } else {
         async_payload_();
       }
+
+      payload_status_ = std::future<void>();
+      n_threads_ready_ = 0;
+      finalized_ = true;
+    }
+
+    /**
+     * Mark the object as finalized without executing the payload. This is
+     * used for synchronization points of phases that were skipped
+     * entirely, i.e., where check() has never been called.
+     */
+    void discard()
+    {
+      Assert(!payload_status_.valid(), dealii::ExcInternalError());
+      finalized_ = true;
     }
 
 #ifdef WITH_ASYNC_MPI_EXCHANGE
@@ -168,7 +232,11 @@ namespace ryujin
 #ifdef WITH_OPENMP
         if (++n_threads_ready_ == omp_get_num_threads())
 #endif
+        {
+          /* A new round is in flight and has to be finalized again: */
+          finalized_ = false;
           payload_status_ = std::async(std::launch::async, async_payload_);
+        }
       }
     }
 #else
@@ -179,6 +247,7 @@ namespace ryujin
     const std::function<void()> async_payload_;
     std::future<void> payload_status_;
     std::atomic_int n_threads_ready_;
+    bool finalized_;
   };
 } // namespace ryujin
 
@@ -92,7 +92,13 @@ namespace ryujin
      *
      * The function takes an optional array of states @p stage_U together
      * with a an array of weights @p stage_weights to construct a modified
-     * high-order right-hand side / flux.
+     * high-order right-hand side / flux: The parabolic operator is
+     * evaluated explicitly on every stage_U[s] with weight
+     * stage_weights[s] and implicitly on @p new_U with the remaining
+     * weight 1 - sum_s stage_weights[s].
+     *
+     * The index @p stage enumerates the implicit stages within one step
+     * of the time integrator, starting at 0.
      */
     template <int stages>
     void
@@ -101,7 +107,8 @@ namespace ryujin
          std::array<std::reference_wrapper<const vector_type>, stages> stage_U,
          const std::array<Number, stages> stage_weights,
          vector_type &new_U,
-         const Number tau) const;
+         const Number tau,
+         const unsigned int stage) const;
 
     /**
      * Given a reference to a previous state vector @p old_U at time @p
@@ -120,6 +127,21 @@ namespace ryujin
      */
     void print_solver_statistics(std::ostream &output) const;
 
+    /**
+     * Record the memory consumption (in bytes) of the parabolic solver in
+     * @p statistics.
+     */
+    void
+    memory_statistics(std::map<std::string, std::size_t> &statistics) const;
+
+    /**
+     * Reset the number of restarts and warnings and the solver
+     * statistics (average iteration counts, number of multigrid
+     * rebuilds). This function is called at the beginning of every run of
+     * a batch of parameter files.
+     */
+    void reset_statistics() const;
+
     //@}
     /**
      * @name Accessors
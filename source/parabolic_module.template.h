@@ -52,12 +52,13 @@ namespace ryujin
   template <typename Description, int dim, typename Number>
   template <int stages>
   void ParabolicModule<Description, dim, Number>::step(
-      const vector_type &,
-      const Number,
-      std::array<std::reference_wrapper<const vector_type>, stages>,
-      const std::array<Number, stages>,
-      vector_type &,
-      const Number) const
+      const vector_type &old_U,
+      const Number old_t,
+      std::array<std::reference_wrapper<const vector_type>, stages> stage_U,
+      const std::array<Number, stages> stage_weights,
+      vector_type &new_U,
+      const Number tau,
+      const unsigned int stage) const
   {
     if constexpr (ParabolicSystem::is_identity) {
       AssertThrow(
@@ -68,8 +69,10 @@ namespace ryujin
 
     } else {
 
-      AssertThrow(false, dealii::ExcNotImplemented());
-      __builtin_trap();
+      parabolic_solver_.template backward_euler_step<stages>(
+          old_U, old_t, stage_U, stage_weights, new_U, tau, stage, cycle_++);
+      n_restarts_ = parabolic_solver_.n_restarts();
+      n_warnings_ = parabolic_solver_.n_warnings();
     }
   }
 
@@ -96,6 +99,17 @@ namespace ryujin
     }
   }
 
+  template <typename Description, int dim, typename Number>
+  void ParabolicModule<Description, dim, Number>::reset_statistics() const
+  {
+    if constexpr (!ParabolicSystem::is_identity) {
+      parabolic_solver_.reset_statistics();
+    }
+
+    n_restarts_ = 0;
+    n_warnings_ = 0;
+  }
+
   template <typename Description, int dim, typename Number>
   void ParabolicModule<Description, dim, Number>::print_solver_statistics(
       std::ostream &output) const
@@ -105,4 +119,13 @@ namespace ryujin
     }
   }
 
+  template <typename Description, int dim, typename Number>
+  void ParabolicModule<Description, dim, Number>::memory_statistics(
+      std::map<std::string, std::size_t> &statistics) const
+  {
+    if constexpr (!ParabolicSystem::is_identity) {
+      parabolic_solver_.memory_statistics(statistics);
+    }
+  }
+
 } /* namespace ryujin */
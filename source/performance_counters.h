@@ -0,0 +1,243 @@
+//
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2020 - 2023 by the ryujin authors
+//
+
+#pragma once
+
+#include <compile_time_options.h>
+
+#include "openmp.h"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace ryujin
+{
+  /**
+   * A minimal interface to hardware performance counters based on the
+   * Linux perf_event_open() system call. No external library (such as
+   * LIKWID or PAPI) is needed.
+   *
+   * After a successful call to initialize() every thread of the OpenMP
+   * thread pool owns a set of counters (cycles, instructions, last level
+   * cache misses, and branch misses). The functions start() and stop()
+   * read the counters of all of these threads and accumulate their sum
+   * for a named section. They are called by the Scope class and the
+   * timers of HyperbolicModule, so that counter values are available for
+   * every section of the computing_timer_ map in TimeLoop.
+   *
+   * @note Work executed by threads outside of the OpenMP thread pool
+   * (for example, TBB worker threads used by deal.II's WorkStream) is
+   * not included in the counter values.
+   *
+   * @note start(), stop() and get() are thread safe. A section should
+   * nevertheless only be started and stopped by a single thread at a
+   * time, because the values recorded by start() are stored per section.
+   *
+   * @ingroup Miscellaneous
+   */
+  class PerformanceCounters
+  {
+  public:
+    /**
+     * The hardware events we count.
+     */
+    enum Event : unsigned int {
+      cycles = 0,
+      instructions = 1,
+      cache_misses = 2,
+      branch_misses = 3,
+    };
+
+    static constexpr unsigned int n_events = 4;
+
+    using values_type = std::array<std::uint64_t, n_events>;
+
+    /**
+     * Accumulated counter values and the number of start()/stop() pairs
+     * of a section.
+     */
+    struct Data {
+      values_type values = {};
+      values_type started = {};
+      unsigned int n_calls = 0;
+    };
+
+    PerformanceCounters()
+        : enabled_(false)
+    {
+    }
+
+    ~PerformanceCounters()
+    {
+      finalize();
+    }
+
+    /**
+     * Open the performance counters on all OpenMP threads. Returns false
+     * (and leaves the object disabled) if the counters are not
+     * available, for example due to a restrictive
+     * /proc/sys/kernel/perf_event_paranoid setting.
+     */
+    bool initialize()
+    {
+      finalize();
+
+#ifdef __linux__
+      bool success = true;
+
+      RYUJIN_PARALLEL_REGION_BEGIN
+      RYUJIN_OMP_CRITICAL
+      {
+        std::array<int, n_events> thread_fds;
+        const std::array<std::uint64_t, n_events> configs = {
+            PERF_COUNT_HW_CPU_CYCLES,
+            PERF_COUNT_HW_INSTRUCTIONS,
+            PERF_COUNT_HW_CACHE_MISSES,
+            PERF_COUNT_HW_BRANCH_MISSES};
+
+        for (unsigned int k = 0; k < n_events; ++k) {
+          struct perf_event_attr attr;
+          std::memset(&attr, 0, sizeof(attr));
+          attr.type = PERF_TYPE_HARDWARE;
+          attr.size = sizeof(attr);
+          attr.config = configs[k];
+          attr.exclude_kernel = 1;
+          attr.exclude_hv = 1;
+
+          /* Count for the calling thread on any CPU: */
+          thread_fds[k] = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+          if (thread_fds[k] < 0)
+            success = false;
+        }
+
+        fds_.push_back(thread_fds);
+      }
+      RYUJIN_PARALLEL_REGION_END
+
+      if (!success) {
+        finalize();
+        return false;
+      }
+
+      enabled_ = true;
+      return true;
+#else
+      return false;
+#endif
+    }
+
+    /**
+     * Close all counters and reset all accumulated data.
+     */
+    void finalize()
+    {
+#ifdef __linux__
+      for (const auto &thread_fds : fds_)
+        for (const auto fd : thread_fds)
+          if (fd >= 0)
+            close(fd);
+#endif
+      fds_.clear();
+      data_.clear();
+      enabled_ = false;
+    }
+
+    /**
+     * Return true if counters are collected.
+     */
+    bool enabled() const
+    {
+      return enabled_;
+    }
+
+    /**
+     * Record the current counter values for @p section.
+     */
+    void start(const std::string &section)
+    {
+      if (!enabled_)
+        return;
+      const auto current = read();
+      std::lock_guard<std::mutex> lock(mutex_);
+      data_[section].started = current;
+    }
+
+    /**
+     * Accumulate the counter values since the last call to start() for
+     * @p section.
+     */
+    void stop(const std::string &section)
+    {
+      if (!enabled_)
+        return;
+      const auto current = read();
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto &data = data_[section];
+      for (unsigned int k = 0; k < n_events; ++k)
+        data.values[k] += current[k] - data.started[k];
+      data.n_calls++;
+    }
+
+    /**
+     * Return a pointer to the accumulated data of @p section, or a null
+     * pointer if no data has been recorded.
+     */
+    const Data *get(const std::string &section) const
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      const auto it = data_.find(section);
+      return it == data_.end() ? nullptr : &it->second;
+    }
+
+  private:
+    /**
+     * Read the current counter values summed over all threads.
+     */
+    values_type read() const
+    {
+      values_type result = {};
+#ifdef __linux__
+      for (const auto &thread_fds : fds_)
+        for (unsigned int k = 0; k < n_events; ++k) {
+          std::uint64_t value = 0;
+          if (::read(thread_fds[k], &value, sizeof(value)) ==
+              sizeof(value))
+            result[k] += value;
+        }
+#endif
+      return result;
+    }
+
+    bool enabled_;
+    std::vector<std::array<int, n_events>> fds_;
+    std::map<std::string, Data> data_;
+    mutable std::mutex mutex_;
+  };
+
+
+  /**
+   * Return a reference to the global PerformanceCounters object.
+   *
+   * @ingroup Miscellaneous
+   */
+  inline PerformanceCounters &performance_counters()
+  {
+    static PerformanceCounters counters;
+    return counters;
+  }
+} // namespace ryujin
@@ -0,0 +1,109 @@
+//
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2020 - 2023 by the ryujin authors
+//
+
+#pragma once
+
+#include "openmp.h"
+
+#include <deal.II/base/mpi.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <memory>
+
+namespace ryujin
+{
+  /**
+   * A static estimate of the memory traffic (in bytes) and the number of
+   * floating point operations of a compute kernel. Used for reporting the
+   * achieved memory bandwidth of the individual phases of
+   * HyperbolicModule::step() in relation to the peak bandwidth measured
+   * by measure_memory_bandwidth().
+   *
+   * @ingroup Miscellaneous
+   */
+  struct TrafficEstimate {
+    double bytes = 0.;
+    double flops = 0.;
+
+    TrafficEstimate &operator+=(const TrafficEstimate &other)
+    {
+      bytes += other.bytes;
+      flops += other.flops;
+      return *this;
+    }
+  };
+
+
+  /**
+   * Measure the sustainable memory bandwidth with a STREAM triad kernel
+   * (a[i] = b[i] + s * c[i]) run on the OpenMP thread team of every MPI
+   * rank simultaneously. The arrays are sized to four times the
+   * share of last level cache available to the rank @p cache_capacity
+   * (but at least 8 MiB each). Following the STREAM convention 24 bytes
+   * are accounted per triad update.
+   *
+   * The function returns the best bandwidth out of @p n_repetitions runs
+   * summed over all MPI ranks in bytes per second.
+   *
+   * @ingroup Miscellaneous
+   */
+  inline double measure_memory_bandwidth(const MPI_Comm &mpi_communicator,
+                                         const std::size_t cache_capacity,
+                                         const unsigned int n_repetitions = 10)
+  {
+    const std::size_t size =
+        std::max<std::size_t>(4 * cache_capacity, std::size_t(8) << 20) /
+        sizeof(double);
+
+    /* Deliberately uninitialized so that first touch happens below: */
+    std::unique_ptr<double[]> a(new double[size]);
+    std::unique_ptr<double[]> b(new double[size]);
+    std::unique_ptr<double[]> c(new double[size]);
+
+    const long n = size;
+    const double s = 3.;
+
+    RYUJIN_PARALLEL_REGION_BEGIN
+    RYUJIN_OMP_FOR
+    for (long i = 0; i < n; ++i) {
+      a[i] = 0.;
+      b[i] = 1.;
+      c[i] = 2.;
+    }
+    RYUJIN_PARALLEL_REGION_END
+
+    double best_time = std::numeric_limits<double>::max();
+    for (unsigned int r = 0; r < n_repetitions; ++r) {
+#ifdef DEAL_II_WITH_MPI
+      MPI_Barrier(mpi_communicator);
+#endif
+      const auto start = std::chrono::steady_clock::now();
+
+      RYUJIN_PARALLEL_REGION_BEGIN
+      RYUJIN_OMP_FOR
+      for (long i = 0; i < n; ++i)
+        a[i] = b[i] + s * c[i];
+      RYUJIN_PARALLEL_REGION_END
+
+      const std::chrono::duration<double> duration =
+          std::chrono::steady_clock::now() - start;
+
+      /* The slowest rank determines the time of a repetition: */
+      const double time =
+          dealii::Utilities::MPI::max(duration.count(), mpi_communicator);
+      best_time = std::min(best_time, time);
+    }
+
+    /* Prevent the compiler from optimizing the kernel away: */
+    volatile double sink = a[n / 2];
+    (void)sink;
+
+    const double bytes = 3. * sizeof(double) * size;
+    return dealii::Utilities::MPI::sum(bytes, mpi_communicator) / best_time;
+  }
+} // namespace ryujin
@@ -0,0 +1,277 @@
+//
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2020 - 2023 by the ryujin authors
+//
+
+#pragma once
+
+#include "sparse_matrix_simd.h"
+
+#include <deal.II/base/exceptions.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace ryujin
+{
+  /**
+   * A partition of the locally owned index range [0, n_owned) into
+   * blocks of consecutive rows, together with the local dependency graph
+   * between these blocks induced by the sparsity pattern.
+   *
+   * The class is used to replace global thread barriers between
+   * consecutive phases of HyperbolicModule::step() by point-to-point
+   * synchronization: A thread that is about to process a row block in a
+   * phase only waits for the neighboring row blocks (i.e., all blocks
+   * containing a column index of the row block) to have completed the
+   * preceding phase. Row blocks that either read ghost values, or that
+   * contain export indices, additionally wait for the ghost exchange of
+   * the preceding phase to have completed.
+   *
+   * Blocks are laid out such that the vectorized index range [0,
+   * n_internal) and the non-vectorized index range [n_internal, n_owned)
+   * are partitioned separately. Within the vectorized range the block size
+   * is a multiple of simd_length. Without dependency tracking every row of
+   * the non-vectorized range forms its own block, which recovers the
+   * row-wise distribution of work of a plain RYUJIN_OMP_FOR loop.
+   *
+   * Completion of a phase is recorded with a monotonically increasing
+   * "epoch" number, which avoids having to reset the status of all blocks
+   * before every phase.
+   *
+   * @ingroup Miscellaneous
+   */
+  template <int simd_length>
+  class RowBlockSchedule
+  {
+  public:
+    /**
+     * Default constructor.
+     */
+    RowBlockSchedule()
+        : track_dependencies_(false)
+        , epoch_(0)
+        , ghost_status_(0)
+    {
+    }
+
+    /**
+     * Reinitialize the row block partition for a given SIMD sparsity
+     * pattern. If @p track_dependencies is set to false, only the row
+     * block partition is set up and all synchronization functions are
+     * no-ops.
+     */
+    void reinit(const SparsityPatternSIMD<simd_length> &sparsity,
+                const unsigned int n_export_indices,
+                const unsigned int n_internal,
+                const unsigned int n_owned,
+                unsigned int block_size,
+                const bool track_dependencies)
+    {
+      Assert(n_internal % simd_length == 0, dealii::ExcInternalError());
+      Assert(n_internal <= n_owned, dealii::ExcInternalError());
+
+      track_dependencies_ = track_dependencies;
+      epoch_ = 0;
+      ghost_status_ = 0;
+
+      /* Round block size up to the next multiple of simd_length: */
+      block_size = std::max(block_size, 1u);
+      block_size = (block_size + simd_length - 1) / simd_length * simd_length;
+
+      block_starts_.clear();
+      for (unsigned int i = 0; i < n_internal; i += block_size)
+        block_starts_.push_back(i);
+      const unsigned int tail_block_size = track_dependencies ? block_size : 1;
+      for (unsigned int i = n_internal; i < n_owned; i += tail_block_size)
+        block_starts_.push_back(i);
+      block_starts_.push_back(n_owned);
+
+      const unsigned int n_blocks = block_starts_.size() - 1;
+
+      dependency_starts_.clear();
+      dependencies_.clear();
+      communicates_.clear();
+      status_.reset();
+
+      if (!track_dependencies_)
+        return;
+
+      dependency_starts_.reserve(n_blocks + 1);
+      dependency_starts_.push_back(0);
+      communicates_.resize(n_blocks, false);
+
+      std::vector<unsigned int> row_dependencies;
+      for (unsigned int b = 0; b < n_blocks; ++b) {
+        row_dependencies.clear();
+        row_dependencies.push_back(b);
+
+        const auto [left, right] = block_range(b);
+
+        if (left < n_export_indices)
+          communicates_[b] = true;
+
+        for (unsigned int i = left; i < right; ++i) {
+          const unsigned int stride = sparsity.stride_of_row(i);
+          const unsigned int row_length = sparsity.row_length(i);
+          const unsigned int *js = sparsity.columns(i);
+          for (unsigned int col_idx = 0; col_idx < row_length; ++col_idx) {
+            const unsigned int j = js[col_idx * stride];
+            if (j >= n_owned) {
+              communicates_[b] = true;
+              continue;
+            }
+            const unsigned int block_of_j = block_of_row(j);
+            if (block_of_j != row_dependencies.back())
+              row_dependencies.push_back(block_of_j);
+          }
+        }
+
+        std::sort(row_dependencies.begin(), row_dependencies.end());
+        const auto last =
+            std::unique(row_dependencies.begin(), row_dependencies.end());
+        dependencies_.insert(
+            dependencies_.end(), row_dependencies.begin(), last);
+        dependency_starts_.push_back(dependencies_.size());
+      }
+
+      status_ = std::make_unique<std::atomic<std::uint64_t>[]>(n_blocks);
+      for (unsigned int b = 0; b < n_blocks; ++b)
+        status_[b].store(0);
+    }
+
+    /**
+     * Return true if dependencies between row blocks are tracked.
+     */
+    bool track_dependencies() const
+    {
+      return track_dependencies_;
+    }
+
+    /**
+     * Return the number of row blocks.
+     */
+    unsigned int n_blocks() const
+    {
+      return block_starts_.size() - 1;
+    }
+
+    /**
+     * Return the index of the row block containing the given @p row.
+     * For @p row equal to n_owned the total number of row blocks is
+     * returned.
+     */
+    unsigned int block_of_row(const unsigned int row) const
+    {
+      const auto it =
+          std::upper_bound(block_starts_.begin(), block_starts_.end(), row);
+      return std::distance(block_starts_.begin(), it) - 1;
+    }
+
+    /**
+     * Return the half open row index range [left, right) of row block
+     * @p b.
+     */
+    std::pair<unsigned int, unsigned int>
+    block_range(const unsigned int b) const
+    {
+      AssertIndexRange(b, n_blocks());
+      return {block_starts_[b], block_starts_[b + 1]};
+    }
+
+    /**
+     * Reserve @p n_phases consecutive epoch numbers for the phases of a
+     * new step and return the base. Phase k (with 1 <= k <= n_phases)
+     * then uses the epoch number base + k.
+     *
+     * The function must be called from a serial context.
+     */
+    std::uint64_t begin_step(const unsigned int n_phases)
+    {
+      const auto base = epoch_;
+      epoch_ += n_phases;
+      return base;
+    }
+
+    /**
+     * Record that row block @p b has completed the phase with number
+     * @p epoch.
+     */
+    void mark_done(const unsigned int b, const std::uint64_t epoch) const
+    {
+      if (!track_dependencies_)
+        return;
+      /* Also orders preceding non-temporal (streaming) stores: */
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      status_[b].store(epoch, std::memory_order_release);
+    }
+
+    /**
+     * Wait until all row blocks that row block @p b depends on have
+     * completed the phase with number @p epoch. If row block @p b reads
+     * ghost values (or contains export indices) also wait for the
+     * corresponding ghost exchange to have finished.
+     */
+    void wait_for_dependencies(const unsigned int b,
+                               const std::uint64_t epoch) const
+    {
+      if (!track_dependencies_)
+        return;
+
+      for (unsigned int k = dependency_starts_[b];
+           k < dependency_starts_[b + 1];
+           ++k)
+        wait_for_block(dependencies_[k], epoch);
+
+      if (communicates_[b])
+        while (ghost_status_.load(std::memory_order_acquire) < epoch)
+          std::this_thread::yield();
+    }
+
+    /**
+     * Wait until all row blocks intersecting with the index range [0,
+     * @p row) have completed the phase with number @p epoch.
+     */
+    void wait_for_rows(const unsigned int row, const std::uint64_t epoch) const
+    {
+      if (!track_dependencies_)
+        return;
+
+      for (unsigned int b = 0; b < n_blocks() && block_starts_[b] < row; ++b)
+        wait_for_block(b, epoch);
+    }
+
+    /**
+     * Record that the ghost exchange following the phase with number
+     * @p epoch has finished.
+     */
+    void mark_ghost_values_ready(const std::uint64_t epoch) const
+    {
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      ghost_status_.store(epoch, std::memory_order_release);
+    }
+
+  private:
+    void wait_for_block(const unsigned int b, const std::uint64_t epoch) const
+    {
+      while (status_[b].load(std::memory_order_acquire) < epoch)
+        std::this_thread::yield();
+    }
+
+    bool track_dependencies_;
+    std::uint64_t epoch_;
+
+    std::vector<unsigned int> block_starts_;
+    std::vector<unsigned int> dependency_starts_;
+    std::vector<unsigned int> dependencies_;
+    std::vector<bool> communicates_;
+
+    std::unique_ptr<std::atomic<std::uint64_t>[]> status_;
+    mutable std::atomic<std::uint64_t> ghost_status_;
+  };
+
+} // namespace ryujin
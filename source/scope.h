@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include "performance_counters.h"
+
 #include <deal.II/base/timer.h>
 
 #include <map>
@@ -16,7 +18,8 @@ namespace ryujin
    * A RAII scope for deal.II timer objects.
    *
    * This class does not perform MPI synchronization in contrast to the
-   * deal.II counterpart.
+   * deal.II counterpart. If enabled, hardware performance counters are
+   * collected for the section as well, see PerformanceCounters.
    *
    * @ingroup Miscellaneous
    */
@@ -32,6 +35,7 @@ namespace ryujin
         , section_(section)
     {
       computing_timer_[section_].start();
+      performance_counters().start(section_);
 #ifdef DEBUG_OUTPUT
       std::cout << "{scoped timer} \"" << section_ << "\" started" << std::endl;
 #endif
@@ -45,6 +49,7 @@ namespace ryujin
 #ifdef DEBUG_OUTPUT
       std::cout << "{scoped timer} \"" << section_ << "\" stopped" << std::endl;
 #endif
+      performance_counters().stop(section_);
       computing_timer_[section_].stop();
     }
 
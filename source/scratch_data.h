@@ -7,8 +7,10 @@
 
 #include "discretization.h"
 
+#include <deal.II/base/quadrature_lib.h>
 #include <deal.II/fe/fe_values.h>
 #include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/vector.h>
 
 namespace ryujin
 {
@@ -22,15 +24,28 @@ namespace ryujin
   {
   public:
     AssemblyScratchData(const AssemblyScratchData<dim> &assembly_scratch_data)
-        : AssemblyScratchData(assembly_scratch_data.discretization_)
+        : AssemblyScratchData(assembly_scratch_data.discretization_,
+                              assembly_scratch_data.fe_values_.get_fe())
     {
     }
 
 
     AssemblyScratchData(const Discretization<dim> &discretization)
+        : AssemblyScratchData(discretization, discretization.finite_element())
+    {
+    }
+
+
+    /**
+     * Use @p finite_element instead of Discretization::finite_element(),
+     * for example for the lower order spaces of the p-multigrid
+     * hierarchy.
+     */
+    AssemblyScratchData(const Discretization<dim> &discretization,
+                        const dealii::FiniteElement<dim> &finite_element)
         : discretization_(discretization)
         , fe_values_(discretization_.mapping(),
-                     discretization_.finite_element(),
+                     finite_element,
                      discretization_.quadrature(),
                      dealii::update_values | dealii::update_gradients |
                          dealii::update_quadrature_points |
@@ -42,6 +57,58 @@ namespace ryujin
     dealii::FEValues<dim> fe_values_;
   };
 
+  /**
+   * Internal scratch data for the thread parallelized construction of
+   * boundary maps. See the deal.II Workstream documentation for details.
+   */
+  template <int dim>
+  class BoundaryScratchData
+  {
+  public:
+    BoundaryScratchData(const BoundaryScratchData<dim> &boundary_scratch_data)
+        : BoundaryScratchData(boundary_scratch_data.discretization_,
+                              boundary_scratch_data.fe_face_values_.get_fe())
+    {
+    }
+
+
+    BoundaryScratchData(const Discretization<dim> &discretization,
+                        const dealii::FiniteElement<dim> &finite_element)
+        : discretization_(discretization)
+        , face_quadrature_(3)
+        , fe_face_values_(discretization_.mapping(),
+                          finite_element,
+                          face_quadrature_,
+                          dealii::update_normal_vectors |
+                              dealii::update_values |
+                              dealii::update_JxW_values)
+    {
+    }
+
+    const Discretization<dim> &discretization_;
+    const dealii::QGauss<dim - 1> face_quadrature_;
+    dealii::FEFaceValues<dim> fe_face_values_;
+    std::vector<dealii::types::global_dof_index> local_dof_indices_;
+
+    /* Support points of the current cell, computed on demand: */
+    std::vector<dealii::Point<dim>> positions_;
+    std::vector<bool> position_computed_;
+  };
+
+
+  /**
+   * Internal copy data for the thread parallelized construction of
+   * boundary maps: all (index, boundary description) pairs of a cell in
+   * the order they are merged into the boundary map.
+   */
+  template <typename Entry>
+  class BoundaryCopyData
+  {
+  public:
+    std::vector<Entry> entries_;
+  };
+
+
   /**
    * Internal copy data for thread parallelized assembly. See the deal.II
    * Workstream documentation for details.
@@ -58,4 +125,19 @@ namespace ryujin
     Number cell_measure_;
   };
 
+
+  /**
+   * Internal copy data for the thread parallelized assembly of lumped
+   * mass matrices on multigrid levels. See the deal.II Workstream
+   * documentation for details.
+   */
+  template <typename Number = double>
+  class LevelAssemblyCopyData
+  {
+  public:
+    bool is_locally_owned_;
+    std::vector<dealii::types::global_dof_index> local_dof_indices_;
+    dealii::Vector<Number> cell_lumped_mass_;
+  };
+
 } // namespace ryujin
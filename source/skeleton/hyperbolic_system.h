@@ -202,7 +202,9 @@ namespace ryujin
 
         /**
          * Step 0: precompute values for hyperbolic update. This routine is
-         * called within our usual loop() idiom in HyperbolicModule
+         * called within our usual loop() idiom in HyperbolicModule. The
+         * caller synchronizes all threads after the loop, so the final
+         * work-sharing loop may be issued with RYUJIN_OMP_FOR_NOWAIT.
          */
         template <typename DISPATCH, typename SPARSITY>
         void
@@ -8,9 +8,12 @@
 #include <compile_time_options.h>
 
 #include "offline_data.h"
+#include "openmp.h"
 
 #include <deal.II/distributed/solution_transfer.h>
 
+#include <memory>
+
 namespace ryujin
 {
 
@@ -21,6 +24,11 @@ namespace ryujin
    * interpolates/restricts the primitive state field via deal.II's
    * SolutionTransfer mechanism.
    *
+   * The auxiliary component vectors are kept between calls and are only
+   * reinitialized if the scalar partitioner has changed. An object of
+   * this class can thus be kept around and reused for every refinement
+   * cycle.
+   *
    * @ingroup TimeLoop
    */
   template <typename Description, int dim, typename Number = double>
@@ -66,7 +74,6 @@ namespace ryujin
                      const HyperbolicSystem &hyperbolic_system)
         : offline_data_(&offline_data)
         , hyperbolic_system_(hyperbolic_system)
-        , solution_transfer_(offline_data.dof_handler())
     {
     }
 
@@ -85,12 +92,16 @@ namespace ryujin
 
       state_.resize(problem_dimension);
       for (auto &it : state_)
-        it.reinit(scalar_partitioner);
+        if (it.get_partitioner() != scalar_partitioner)
+          it.reinit(scalar_partitioner);
 
       const unsigned int n_owned = offline_data_->n_locally_owned();
 
       /* copy over the primitive state: */
 
+      RYUJIN_PARALLEL_REGION_BEGIN
+
+      RYUJIN_OMP_FOR
       for (unsigned int i = 0; i < n_owned; ++i) {
         const auto U_i = U.get_tensor(i);
         const auto primitive_state = hyperbolic_system_.to_primitive_state(U_i);
@@ -99,17 +110,31 @@ namespace ryujin
           state_[k].local_element(i) = primitive_state[k];
       }
 
-      for (auto &it : state_) {
+      RYUJIN_PARALLEL_REGION_END
+
+      /*
+       * Distribute constraints and exchange ghost values of all components
+       * at once:
+       */
+
+      for (auto &it : state_)
         affine_constraints.distribute(it);
-        it.update_ghost_values();
-      }
+
+      for (unsigned int k = 0; k < problem_dimension; ++k)
+        state_[k].update_ghost_values_start(k);
+      for (unsigned int k = 0; k < problem_dimension; ++k)
+        state_[k].update_ghost_values_finish();
 
       std::vector<const scalar_type *> ptr_state;
       std::transform(state_.begin(),
                      state_.end(),
                      std::back_inserter(ptr_state),
                      [](auto &it) { return &it; });
-      solution_transfer_.prepare_for_coarsening_and_refinement(ptr_state);
+
+      solution_transfer_ = std::make_unique<
+          dealii::parallel::distributed::SolutionTransfer<dim, scalar_type>>(
+          offline_data_->dof_handler());
+      solution_transfer_->prepare_for_coarsening_and_refinement(ptr_state);
     }
 
     /**
@@ -121,13 +146,20 @@ namespace ryujin
      */
     void interpolate(vector_type &U)
     {
+      Assert(solution_transfer_,
+             dealii::ExcMessage("prepare_for_interpolation() has to be "
+                                "called before interpolate()"));
+
       const auto &scalar_partitioner = offline_data_->scalar_partitioner();
 
       U.reinit(offline_data_->vector_partitioner());
 
       interpolated_state_.resize(problem_dimension);
       for (auto &it : interpolated_state_) {
-        it.reinit(scalar_partitioner);
+        if (it.get_partitioner() != scalar_partitioner)
+          it.reinit(scalar_partitioner);
+        else
+          it = Number(0.);
         it.zero_out_ghost_values();
       }
 
@@ -136,12 +168,16 @@ namespace ryujin
                      interpolated_state_.end(),
                      std::back_inserter(ptr_interpolated_state),
                      [](auto &it) { return &it; });
-      solution_transfer_.interpolate(ptr_interpolated_state);
+      solution_transfer_->interpolate(ptr_interpolated_state);
+      solution_transfer_.reset();
 
       const unsigned int n_owned = offline_data_->n_locally_owned();
 
       /* copy over primitive_state: */
 
+      RYUJIN_PARALLEL_REGION_BEGIN
+
+      RYUJIN_OMP_FOR
       for (unsigned int i = 0; i < n_owned; ++i) {
         state_type U_i;
         for (unsigned int k = 0; k < problem_dimension; ++k)
@@ -151,7 +187,16 @@ namespace ryujin
         U.write_tensor(U_i, i);
       }
 
+      RYUJIN_PARALLEL_REGION_END
+
       U.update_ghost_values();
+
+      /*
+       * The interpolated state lives on the new partition. Swap it into
+       * state_ so that the next call to prepare_for_interpolation() can
+       * reuse the vectors without reinitialization.
+       */
+      state_.swap(interpolated_state_);
     }
 
   private:
@@ -163,7 +208,8 @@ namespace ryujin
     dealii::SmartPointer<const OfflineData<dim, Number>> offline_data_;
     const HyperbolicSystemView hyperbolic_system_;
 
-    dealii::parallel::distributed::SolutionTransfer<dim, scalar_type>
+    std::unique_ptr<
+        dealii::parallel::distributed::SolutionTransfer<dim, scalar_type>>
         solution_transfer_;
 
     std::vector<scalar_type> state_;
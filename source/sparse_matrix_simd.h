@@ -6,6 +6,7 @@
 #pragma once
 
 #include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/memory_consumption.h>
 #include <deal.II/base/partitioner.h>
 #include <deal.II/lac/dynamic_sparsity_pattern.h>
 
@@ -19,6 +20,10 @@ namespace ryujin
             int simd_length = dealii::VectorizedArray<Number>::size()>
   class SparseMatrixSIMD;
 
+  template <typename Number,
+            int simd_length = dealii::VectorizedArray<Number>::size()>
+  class QuantizedSparseMatrixSIMD;
+
   /**
    * A specialized sparsity pattern for efficient vectorized SIMD access.
    *
@@ -87,6 +92,12 @@ namespace ryujin
 
     std::size_t n_nonzero_elements() const;
 
+    /**
+     * Return an estimate of the memory consumption (in bytes) of this
+     * object.
+     */
+    std::size_t memory_consumption() const;
+
   private:
     unsigned int n_internal_dofs;
     unsigned int n_locally_owned_dofs;
@@ -103,6 +114,9 @@ namespace ryujin
 
     template <typename, int, int>
     friend class SparseMatrixSIMD;
+
+    template <typename, int>
+    friend class QuantizedSparseMatrixSIMD;
   };
 
 
@@ -234,6 +248,13 @@ namespace ryujin
 
     void update_ghost_rows();
 
+    /**
+     * Return an estimate of the memory consumption (in bytes) of this
+     * object. The memory consumption of the underlying sparsity pattern
+     * is not included.
+     */
+    std::size_t memory_consumption() const;
+
   private:
     const SparsityPatternSIMD<simd_length> *sparsity;
     dealii::AlignedVector<Number> data;
@@ -306,6 +327,29 @@ namespace ryujin
   }
 
 
+  template <int simd_length>
+  inline std::size_t
+  SparsityPatternSIMD<simd_length>::memory_consumption() const
+  {
+    return row_starts.memory_consumption() +
+           column_indices.memory_consumption() +
+           indices_transposed.memory_consumption() +
+           indices_to_be_sent.memory_consumption() +
+           dealii::MemoryConsumption::memory_consumption(send_targets) +
+           dealii::MemoryConsumption::memory_consumption(receive_targets);
+  }
+
+
+  template <typename Number, int n_components, int simd_length>
+  inline std::size_t
+  SparseMatrixSIMD<Number, n_components, simd_length>::memory_consumption()
+      const
+  {
+    return data.memory_consumption() + exchange_buffer.memory_consumption() +
+           requests.capacity() * sizeof(MPI_Request);
+  }
+
+
   template <typename Number, int n_components, int simd_length>
   template <typename Number2>
   DEAL_II_ALWAYS_INLINE inline Number2
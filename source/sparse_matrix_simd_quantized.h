@@ -0,0 +1,458 @@
+//
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2020 - 2023 by the ryujin authors
+//
+
+#pragma once
+
+#include "sparse_matrix_simd.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace ryujin
+{
+  /**
+   * A compact variant of SparseMatrixSIMD<Number> for storing scalar
+   * coefficients in the interval [0, 1] (such as the limiter coefficients
+   * l_ij of the convex limiter) in a 16-bit fixed-point representation.
+   *
+   * The matrix uses the same memory layout as SparseMatrixSIMD (see the
+   * documentation of class SparsityPatternSIMD) but stores an unsigned
+   * 16-bit integer q per entry representing the value q / 65535. Values
+   * are quantized by rounding down, i.e., the value read back from the
+   * matrix is always less than or equal to the value that was written
+   * (after clamping to [0, 1]), and the quantization error is bounded by
+   * 1/65535. For limiter coefficients this preserves the invariant-domain
+   * property: any coefficient smaller than an admissible limiter
+   * coefficient is admissible as well.
+   *
+   * @ingroup SIMD
+   */
+  template <typename Number, int simd_length>
+  class QuantizedSparseMatrixSIMD
+  {
+  public:
+    QuantizedSparseMatrixSIMD();
+
+    QuantizedSparseMatrixSIMD(const SparsityPatternSIMD<simd_length> &sparsity);
+
+    void reinit(const SparsityPatternSIMD<simd_length> &sparsity);
+
+    using VectorizedArray = dealii::VectorizedArray<Number, simd_length>;
+
+    /**
+     * The fixed-point level representing the value 1.
+     */
+    static constexpr std::uint16_t max_level = 65535;
+
+    /**
+     * Return the fixed-point representation of @p value rounded down.
+     * The value is clamped to [0, 1] first, a NaN is mapped to 0.
+     */
+    static std::uint16_t quantize(const Number value);
+
+    /**
+     * Return the value represented by the fixed-point number @p level.
+     */
+    static Number dequantize(const std::uint16_t level);
+
+    /**
+     * return the (scalar) entry indexed by @p row and
+     * @p position_within_column.
+     *
+     * @note If the template argument @a Number2
+     * is a vetorized array a specialized, faster access will be performed.
+     * In this case the index @p row must be within the interval
+     * [0, n_internal_dofs) and must be divisible by simd_length.
+     */
+    template <typename Number2 = Number>
+    Number2 get_entry(const unsigned int row,
+                      const unsigned int position_within_column) const;
+
+    /**
+     * return the transposed (scalar) entry indexed by @p row and
+     * @p position_within_column.
+     *
+     * @note If the template argument @a Number2
+     * is a vetorized array a specialized, faster access will be performed.
+     * In this case the index @p row must be within the interval
+     * [0, n_internal_dofs) and must be divisible by simd_length.
+     */
+    template <typename Number2 = Number>
+    Number2
+    get_transposed_entry(const unsigned int row,
+                         const unsigned int position_within_column) const;
+
+    /**
+     * Write a (scalar valued) @p entry rounded down to the matrix indexed
+     * by @p row and @p position_within_column.
+     *
+     * @note If the template argument @a Number2
+     * is a vetorized array a specialized, faster access will be performed.
+     * In this case the index @p row must be within the interval
+     * [0, n_internal_dofs) and must be divisible by simd_length.
+     *
+     * @note The @p do_streaming_store argument is accepted for interface
+     * compatibility with SparseMatrixSIMD and ignored: the 16-bit entries
+     * of a SIMD row block do not fill a full vector register.
+     */
+    template <typename Number2 = Number>
+    void write_entry(const Number2 entry,
+                     const unsigned int row,
+                     const unsigned int position_within_column,
+                     const bool do_streaming_store = false);
+
+    /* Synchronize over MPI ranks: */
+
+    void update_ghost_rows_start(const unsigned int communication_channel = 0);
+
+    void update_ghost_rows_finish();
+
+    void update_ghost_rows();
+
+    /**
+     * Return an estimate of the memory consumption (in bytes) of this
+     * object. The memory consumption of the underlying sparsity pattern
+     * is not included.
+     */
+    std::size_t memory_consumption() const;
+
+  private:
+    const SparsityPatternSIMD<simd_length> *sparsity;
+    dealii::AlignedVector<std::uint16_t> data;
+    dealii::AlignedVector<std::uint16_t> exchange_buffer;
+    std::vector<MPI_Request> requests;
+  };
+
+  /*
+   * Inline function  definitions:
+   */
+
+
+  template <typename Number, int simd_length>
+  inline QuantizedSparseMatrixSIMD<Number,
+                                   simd_length>::QuantizedSparseMatrixSIMD()
+      : sparsity(nullptr)
+  {
+  }
+
+
+  template <typename Number, int simd_length>
+  inline QuantizedSparseMatrixSIMD<Number, simd_length>::
+      QuantizedSparseMatrixSIMD(
+          const SparsityPatternSIMD<simd_length> &sparsity)
+      : sparsity(&sparsity)
+  {
+    data.resize(sparsity.n_nonzero_elements());
+  }
+
+
+  template <typename Number, int simd_length>
+  inline void QuantizedSparseMatrixSIMD<Number, simd_length>::reinit(
+      const SparsityPatternSIMD<simd_length> &sparsity)
+  {
+    this->sparsity = &sparsity;
+    data.resize(sparsity.n_nonzero_elements());
+  }
+
+
+  template <typename Number, int simd_length>
+  inline std::size_t
+  QuantizedSparseMatrixSIMD<Number, simd_length>::memory_consumption() const
+  {
+    return data.memory_consumption() + exchange_buffer.memory_consumption() +
+           requests.capacity() * sizeof(MPI_Request);
+  }
+
+
+  template <typename Number, int simd_length>
+  DEAL_II_ALWAYS_INLINE inline Number
+  QuantizedSparseMatrixSIMD<Number, simd_length>::dequantize(
+      const std::uint16_t level)
+  {
+    constexpr Number scale = Number(1.) / Number(max_level);
+    return Number(level) * scale;
+  }
+
+
+  template <typename Number, int simd_length>
+  DEAL_II_ALWAYS_INLINE inline std::uint16_t
+  QuantizedSparseMatrixSIMD<Number, simd_length>::quantize(
+      const Number value)
+  {
+    /* The argument order ensures that a NaN is mapped to 0: */
+    const Number clamped =
+        std::max(Number(0.), std::min(value, Number(1.)));
+
+    auto level = static_cast<std::uint16_t>(clamped * Number(max_level));
+
+    /*
+     * The product above is rounded to nearest and the truncation might
+     * thus round up by one level. Correct for this so that
+     * dequantize(level) <= clamped holds exactly:
+     */
+    if (dequantize(level) > clamped)
+      --level;
+
+    return level;
+  }
+
+
+  template <typename Number, int simd_length>
+  template <typename Number2>
+  DEAL_II_ALWAYS_INLINE inline Number2
+  QuantizedSparseMatrixSIMD<Number, simd_length>::get_entry(
+      const unsigned int row, const unsigned int position_within_column) const
+  {
+    Assert(sparsity != nullptr, dealii::ExcNotInitialized());
+    AssertIndexRange(row, sparsity->row_starts.size() - 1);
+    AssertIndexRange(position_within_column, sparsity->row_length(row));
+
+    if constexpr (std::is_same<Number, Number2>::value) {
+      /*
+       * Non-vectorized slow access. Supports all row indices in
+       * [0,n_owned)
+       */
+      if (row < sparsity->n_internal_dofs) {
+        // go through vectorized part
+        const unsigned int simd_row = row / simd_length;
+        const unsigned int simd_offset = row % simd_length;
+        return dequantize(data[sparsity->row_starts[simd_row] +
+                               position_within_column * simd_length +
+                               simd_offset]);
+      } else {
+        // go through standard part
+        return dequantize(
+            data[sparsity->row_starts[row] + position_within_column]);
+      }
+
+    } else if constexpr (std::is_same<VectorizedArray, Number2>::value) {
+      /*
+       * Vectorized fast access. Indices must be in the range
+       * [0,n_internal), index must be divisible by simd_length
+       */
+
+      Assert(row < sparsity->n_internal_dofs,
+             dealii::ExcMessage(
+                 "Vectorized access only possible in vectorized part"));
+      Assert(row % simd_length == 0,
+             dealii::ExcMessage(
+                 "Access only supported for rows at the SIMD granularity"));
+
+      const std::uint16_t *load_pos =
+          data.data() + sparsity->row_starts[row / simd_length] +
+          position_within_column * simd_length;
+
+      VectorizedArray result;
+      for (unsigned int k = 0; k < simd_length; ++k)
+        result[k] = dequantize(load_pos[k]);
+      return result;
+
+    } else {
+      /* not implemented */
+      __builtin_trap();
+    }
+  }
+
+
+  template <typename Number, int simd_length>
+  template <typename Number2>
+  DEAL_II_ALWAYS_INLINE inline Number2
+  QuantizedSparseMatrixSIMD<Number, simd_length>::get_transposed_entry(
+      const unsigned int row, const unsigned int position_within_column) const
+  {
+    Assert(sparsity != nullptr, dealii::ExcNotInitialized());
+    AssertIndexRange(row, sparsity->row_starts.size() - 1);
+    AssertIndexRange(position_within_column, sparsity->row_length(row));
+
+    if constexpr (std::is_same<Number, Number2>::value) {
+      /*
+       * Non-vectorized slow access. Supports all row indices in
+       * [0,n_owned)
+       */
+      if (row < sparsity->n_internal_dofs) {
+        // go through vectorized part
+        const unsigned int simd_row = row / simd_length;
+        const unsigned int simd_offset = row % simd_length;
+        return dequantize(
+            data[sparsity->indices_transposed[sparsity->row_starts[simd_row] +
+                                              simd_offset +
+                                              position_within_column *
+                                                  simd_length]]);
+      } else {
+        // go through standard part
+        return dequantize(
+            data[sparsity->indices_transposed[sparsity->row_starts[row] +
+                                              position_within_column]]);
+      }
+
+    } else if constexpr (std::is_same<VectorizedArray, Number2>::value) {
+      /*
+       * Vectorized fast access. Indices must be in the range
+       * [0,n_internal), index must be divisible by simd_length
+       */
+
+      Assert(row < sparsity->n_internal_dofs,
+             dealii::ExcMessage(
+                 "Vectorized access only possible in vectorized part"));
+      Assert(row % simd_length == 0,
+             dealii::ExcMessage(
+                 "Access only supported for rows at the SIMD granularity"));
+
+      const unsigned int *indices =
+          sparsity->indices_transposed.data() +
+          sparsity->row_starts[row / simd_length] +
+          position_within_column * simd_length;
+
+      VectorizedArray result;
+      for (unsigned int k = 0; k < simd_length; ++k)
+        result[k] = dequantize(data[indices[k]]);
+      return result;
+
+    } else {
+      /* not implemented */
+      __builtin_trap();
+    }
+  }
+
+
+  template <typename Number, int simd_length>
+  template <typename Number2>
+  DEAL_II_ALWAYS_INLINE inline void
+  QuantizedSparseMatrixSIMD<Number, simd_length>::write_entry(
+      const Number2 entry,
+      const unsigned int row,
+      const unsigned int position_within_column,
+      const bool /*do_streaming_store*/)
+  {
+    Assert(sparsity != nullptr, dealii::ExcNotInitialized());
+    AssertIndexRange(row, sparsity->row_starts.size() - 1);
+    AssertIndexRange(position_within_column, sparsity->row_length(row));
+
+    if constexpr (std::is_same<Number, Number2>::value) {
+      /*
+       * Non-vectorized slow access. Supports all row indices in
+       * [0,n_owned)
+       */
+      if (row < sparsity->n_internal_dofs) {
+        // go through vectorized part
+        const unsigned int simd_row = row / simd_length;
+        const unsigned int simd_offset = row % simd_length;
+        data[sparsity->row_starts[simd_row] +
+             position_within_column * simd_length + simd_offset] =
+            quantize(entry);
+      } else {
+        // go through standard part
+        data[sparsity->row_starts[row] + position_within_column] =
+            quantize(entry);
+      }
+
+    } else if constexpr (std::is_same<VectorizedArray, Number2>::value) {
+      /*
+       * Vectorized fast access. Indices must be in the range
+       * [0,n_internal), index must be divisible by simd_length
+       */
+
+      Assert(row < sparsity->n_internal_dofs,
+             dealii::ExcMessage(
+                 "Vectorized access only possible in vectorized part"));
+      Assert(row % simd_length == 0,
+             dealii::ExcMessage(
+                 "Access only supported for rows at the SIMD granularity"));
+
+      std::uint16_t *store_pos = data.data() +
+                                 sparsity->row_starts[row / simd_length] +
+                                 position_within_column * simd_length;
+
+      for (unsigned int k = 0; k < simd_length; ++k)
+        store_pos[k] = quantize(entry[k]);
+
+    } else {
+      /* not implemented */
+      __builtin_trap();
+    }
+  }
+
+
+  template <typename Number, int simd_length>
+  inline void
+  QuantizedSparseMatrixSIMD<Number, simd_length>::update_ghost_rows_start(
+      const unsigned int communication_channel)
+  {
+#ifdef DEAL_II_WITH_MPI
+    AssertIndexRange(communication_channel, 200);
+
+    const unsigned int mpi_tag =
+        dealii::Utilities::MPI::internal::Tags::partitioner_export_start +
+        communication_channel;
+    Assert(mpi_tag <=
+               dealii::Utilities::MPI::internal::Tags::partitioner_export_end,
+           dealii::ExcInternalError());
+
+    const std::size_t n_indices = sparsity->indices_to_be_sent.size();
+    exchange_buffer.resize_fast(n_indices);
+
+    requests.resize(sparsity->receive_targets.size() +
+                    sparsity->send_targets.size());
+    {
+      const auto &targets = sparsity->receive_targets;
+      for (unsigned int p = 0; p < targets.size(); ++p) {
+        const int ierr = MPI_Irecv(
+            data.data() +
+                sparsity->row_starts[sparsity->n_locally_owned_dofs] +
+                (p == 0 ? 0 : targets[p - 1].second),
+            (targets[p].second - (p == 0 ? 0 : targets[p - 1].second)) *
+                sizeof(std::uint16_t),
+            MPI_BYTE,
+            targets[p].first,
+            mpi_tag,
+            sparsity->mpi_communicator,
+            &requests[p]);
+        AssertThrowMPI(ierr);
+      }
+    }
+
+    for (std::size_t c = 0; c < n_indices; ++c)
+      exchange_buffer[c] = data[sparsity->indices_to_be_sent[c]];
+
+    {
+      const auto &targets = sparsity->send_targets;
+      for (unsigned int p = 0; p < targets.size(); ++p) {
+        const int ierr = MPI_Isend(
+            exchange_buffer.data() + (p == 0 ? 0 : targets[p - 1].second),
+            (targets[p].second - (p == 0 ? 0 : targets[p - 1].second)) *
+                sizeof(std::uint16_t),
+            MPI_BYTE,
+            targets[p].first,
+            mpi_tag,
+            sparsity->mpi_communicator,
+            &requests[p + sparsity->receive_targets.size()]);
+        AssertThrowMPI(ierr);
+      }
+    }
+#endif
+  }
+
+
+  template <typename Number, int simd_length>
+  inline void
+  QuantizedSparseMatrixSIMD<Number, simd_length>::update_ghost_rows_finish()
+  {
+#ifdef DEAL_II_WITH_MPI
+    const int ierr =
+        MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+    AssertThrowMPI(ierr);
+#endif
+  }
+
+
+  template <typename Number, int simd_length>
+  inline void
+  QuantizedSparseMatrixSIMD<Number, simd_length>::update_ghost_rows()
+  {
+    update_ghost_rows_start();
+    update_ghost_rows_finish();
+  }
+
+} // namespace ryujin
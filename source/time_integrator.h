@@ -118,6 +118,37 @@ namespace ryujin
      * Crank-Nicolson for the parabolic subproblem
      */
     strang_erk_33_cn,
+
+    /**
+     * A first-order IMEX scheme combining an explicit Euler step for the
+     * hyperbolic subproblem with an implicit backward Euler step for the
+     * parabolic subproblem.
+     */
+    imex_11,
+
+    /**
+     * A second-order IMEX scheme combining the erk 22 stages for the
+     * hyperbolic subproblem with one implicit parabolic solve per stage.
+     * The parabolic stages are a backward Euler step and a
+     * Crank-Nicolson-type step that evaluates the parabolic operator at
+     * the beginning of the step explicitly.
+     */
+    imex_22,
+
+    /**
+     * A three-stage, second-order IMEX scheme combining the third-order
+     * erk 33 stages for the hyperbolic subproblem with one implicit
+     * parabolic solve per stage. The implicit part is chosen such that
+     * the scheme is of second order and L-stable with respect to the
+     * parabolic subproblem.
+     *
+     * @note The coupled scheme is only second-order accurate: With one
+     * backward Euler type solve per erk 33 stage, every choice of
+     * explicit stage weights that recovers third order requires a stage
+     * with vanishing implicit weight, i.e., a fully explicit evaluation
+     * of the parabolic operator.
+     */
+    imex_32,
   };
 } // namespace ryujin
 
@@ -136,7 +167,10 @@ DECLARE_ENUM(
          {ryujin::TimeSteppingScheme::erk_43, "erk 43"},
          {ryujin::TimeSteppingScheme::erk_54, "erk 54"},
          {ryujin::TimeSteppingScheme::strang_ssprk_33_cn, "strang ssprk 33 cn"},
-         {ryujin::TimeSteppingScheme::strang_erk_33_cn, "strang erk 33 cn"}, ));
+         {ryujin::TimeSteppingScheme::strang_erk_33_cn, "strang erk 33 cn"},
+         {ryujin::TimeSteppingScheme::imex_11, "imex 11"},
+         {ryujin::TimeSteppingScheme::imex_22, "imex 22"},
+         {ryujin::TimeSteppingScheme::imex_32, "imex 32"}, ));
 #endif
 
 namespace ryujin
@@ -207,6 +241,13 @@ namespace ryujin
      */
     void prepare();
 
+    /**
+     * Record the memory consumption (in bytes) of the temporary state
+     * vectors and precomputed values in @p statistics.
+     */
+    void
+    memory_statistics(std::map<std::string, std::size_t> &statistics) const;
+
     /**
      * @name Functions for performing explicit time steps
      */
@@ -292,6 +333,33 @@ namespace ryujin
      */
     Number step_strang_erk_33_cn(vector_type &U, Number t);
 
+    /**
+     * Given a reference to a previous state vector U performs a combined
+     * explicit implicit IMEX(1,1) step consisting of an explicit Euler
+     * step for the hyperbolic subproblem followed by a backward Euler
+     * step for the parabolic subproblem (and store the result in U). The
+     * function returns the chosen time step size tau.
+     */
+    Number step_imex_11(vector_type &U, Number t);
+
+    /**
+     * Given a reference to a previous state vector U performs a combined
+     * explicit implicit second-order IMEX(2,2) time step with one
+     * hyperbolic update and one parabolic solve per stage (and store the
+     * result in U). The function returns the chosen time step size tau.
+     */
+    Number step_imex_22(vector_type &U, Number t);
+
+    /**
+     * Given a reference to a previous state vector U performs a combined
+     * explicit implicit IMEX(3,2) time step with one hyperbolic update and
+     * one parabolic solve per stage (and store the result in U). The
+     * hyperbolic subproblem is integrated with third order, the coupled
+     * scheme is of second order. The function returns the chosen time
+     * step size tau.
+     */
+    Number step_imex_32(vector_type &U, Number t);
+
     /**
      * The selected time-stepping scheme.
      */
@@ -331,6 +399,15 @@ namespace ryujin
     std::vector<vector_type> U_;
     std::vector<precomputed_type> precomputed_;
 
+    /**
+     * The explicit stage weights of the last implicit stage of imex 22
+     * and imex 32, see ParabolicModule::step(). The remaining implicit
+     * weight 1 - sum_s w_s has to be positive, which is checked once in
+     * prepare().
+     */
+    static constexpr std::array<Number, 1> imex_22_weights_{{Number(0.5)}};
+    static constexpr std::array<Number, 1> imex_32_weights_{{Number(0.75)}};
+
     //@}
   };
 
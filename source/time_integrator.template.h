@@ -55,7 +55,8 @@ namespace ryujin
     add_parameter("time stepping scheme",
                   time_stepping_scheme_,
                   "Time stepping scheme: ssprk 33, erk 11, erk 22, erk 33, erk "
-                  "43, erk 54");
+                  "43, erk 54, strang ssprk 33 cn, strang erk 33 cn, imex 11, "
+                  "imex 22, imex 32");
   }
 
 
@@ -101,6 +102,18 @@ namespace ryujin
       U_.resize(4);
       precomputed_.resize(3);
       break;
+    case TimeSteppingScheme::imex_11:
+      U_.resize(2);
+      precomputed_.resize(1);
+      break;
+    case TimeSteppingScheme::imex_22:
+      U_.resize(2);
+      precomputed_.resize(2);
+      break;
+    case TimeSteppingScheme::imex_32:
+      U_.resize(3);
+      precomputed_.resize(3);
+      break;
     }
 
     /* Initialize temporary vectors and matrices: */
@@ -121,6 +134,12 @@ namespace ryujin
 
     hyperbolic_module_->cfl(cfl_max_);
 
+    /* The implicit weight of every IMEX stage must be positive: */
+
+    static_assert(Number(1.) - imex_22_weights_[0] > Number(0.) &&
+                      Number(1.) - imex_32_weights_[0] > Number(0.),
+                  "The implicit weight of every IMEX stage must be positive");
+
     const auto check_whether_timestepping_makes_sense = [&]() {
       /*
        * Make sure the user selects an appropriate time-stepping scheme.
@@ -148,7 +167,13 @@ namespace ryujin
       }
       case TimeSteppingScheme::strang_ssprk_33_cn:
         [[fallthrough]];
-      case TimeSteppingScheme::strang_erk_33_cn: {
+      case TimeSteppingScheme::strang_erk_33_cn:
+        [[fallthrough]];
+      case TimeSteppingScheme::imex_11:
+        [[fallthrough]];
+      case TimeSteppingScheme::imex_22:
+        [[fallthrough]];
+      case TimeSteppingScheme::imex_32: {
         AssertThrow(
             !ParabolicSystem::is_identity,
             dealii::ExcMessage(
@@ -192,6 +217,12 @@ namespace ryujin
         return step_strang_ssprk_33_cn(U, t);
       case TimeSteppingScheme::strang_erk_33_cn:
         return step_strang_erk_33_cn(U, t);
+      case TimeSteppingScheme::imex_11:
+        return step_imex_11(U, t);
+      case TimeSteppingScheme::imex_22:
+        return step_imex_22(U, t);
+      case TimeSteppingScheme::imex_32:
+        return step_imex_32(U, t);
       default:
         __builtin_unreachable();
       }
@@ -587,4 +618,120 @@ namespace ryujin
     return 6. * tau;
   }
 
+
+  template <typename Description, int dim, typename Number>
+  Number TimeIntegrator<Description, dim, Number>::step_imex_11(vector_type &U,
+                                                                Number t)
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "TimeIntegrator<dim, Number>::step_imex_11()" << std::endl;
+#endif
+
+    /* Explicit step 1: U1 <- {U, 1} at time t + tau */
+    Number tau = hyperbolic_module_->template step<0>(
+        U, {}, {}, {}, U_[0], precomputed_[0]);
+    hyperbolic_module_->apply_boundary_conditions(U_[0], t + tau);
+
+    /* Implicit step 1: U1 <- {U1, 1} at time t + tau */
+    parabolic_module_->template step<0>(U_[0], t, {}, {}, U_[1], tau, 0);
+
+    U.swap(U_[1]);
+    return tau;
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  Number TimeIntegrator<Description, dim, Number>::step_imex_22(vector_type &U,
+                                                                Number t)
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "TimeIntegrator<dim, Number>::step_imex_22()" << std::endl;
+#endif
+
+    /* Explicit step 1: U1 <- {U, 1} at time t + tau */
+    Number tau = hyperbolic_module_->template step<0>(
+        U, {}, {}, {}, U_[0], precomputed_[0]);
+    hyperbolic_module_->apply_boundary_conditions(U_[0], t + tau);
+
+    /* Implicit step 1: U1 <- {U1, 1} at time t + tau */
+    parabolic_module_->template step<0>(U_[0], t, {}, {}, U_[1], tau, 0);
+
+    /* Explicit step 2: U2 <- {U1, 2} and {U, -1} at time t + 2 tau */
+    hyperbolic_module_->template step<1>(U_[1],
+                                         {{U}},
+                                         {{precomputed_[0]}},
+                                         {{Number(-1.)}},
+                                         U_[0],
+                                         precomputed_[1],
+                                         tau);
+    hyperbolic_module_->apply_boundary_conditions(U_[0], t + 2. * tau);
+
+    /* Implicit step 2: U2 <- {U2, 1/2} and {U, 1/2} at time t + 2 tau */
+    parabolic_module_->template step<1>(
+        U_[0], t + tau, {{U}}, imex_22_weights_, U_[1], tau, 1);
+
+    U.swap(U_[1]);
+    return 2. * tau;
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  Number TimeIntegrator<Description, dim, Number>::step_imex_32(vector_type &U,
+                                                                Number t)
+  {
+#ifdef DEBUG_OUTPUT
+    std::cout << "TimeIntegrator<dim, Number>::step_imex_32()" << std::endl;
+#endif
+
+    /* Explicit step 1: U1 <- {U, 1} at time t + tau */
+    Number tau = hyperbolic_module_->template step<0>(
+        U, {}, {}, {}, U_[0], precomputed_[0]);
+    hyperbolic_module_->apply_boundary_conditions(U_[0], t + tau);
+
+    /* Implicit step 1: U1 <- {U1, 1} at time t + tau */
+    parabolic_module_->template step<0>(U_[0], t, {}, {}, U_[1], tau, 0);
+
+    /* Explicit step 2: U2 <- {U1, 2} and {U, -1} at time t + 2 tau */
+    hyperbolic_module_->template step<1>(U_[1],
+                                         {{U}},
+                                         {{precomputed_[0]}},
+                                         {{Number(-1.)}},
+                                         U_[0],
+                                         precomputed_[1],
+                                         tau);
+    hyperbolic_module_->apply_boundary_conditions(U_[0], t + 2. * tau);
+
+    /* Implicit step 2: U2 <- {U2, 1} at time t + 2 tau */
+    parabolic_module_->template step<0>(
+        U_[0], t + tau, {}, {}, U_[2], tau, 1);
+
+    /* Explicit step 3: U3 <- {U2, 9/4} and {U1, -2} and {U, 3/4} */
+    hyperbolic_module_->template step<2>(U_[2],
+                                         {{U, U_[1]}},
+                                         {{precomputed_[0], precomputed_[1]}},
+                                         {{Number(0.75), Number(-2.)}},
+                                         U_[0],
+                                         precomputed_[2],
+                                         tau);
+    hyperbolic_module_->apply_boundary_conditions(U_[0], t + 3. * tau);
+
+    /* Implicit step 3: U3 <- {U3, 1/4} and {U1, 3/4} at time t + 3 tau */
+    parabolic_module_->template step<1>(
+        U_[0], t + 2. * tau, {{U_[1]}}, imex_32_weights_, U_[2], tau, 2);
+
+    U.swap(U_[2]);
+    return 3. * tau;
+  }
+
+
+  template <typename Description, int dim, typename Number>
+  void TimeIntegrator<Description, dim, Number>::memory_statistics(
+      std::map<std::string, std::size_t> &statistics) const
+  {
+    using dealii::MemoryConsumption::memory_consumption;
+    statistics["TimeIntegrator - temporary states"] = memory_consumption(U_);
+    statistics["TimeIntegrator - precomputed values"] =
+        memory_consumption(precomputed_);
+  }
+
 } /* namespace ryujin */
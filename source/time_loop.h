@@ -14,6 +14,7 @@
 #include "parabolic_module.h"
 #include "postprocessor.h"
 #include "quantities.h"
+#include "solution_transfer.h"
 #include "time_integrator.h"
 #include "vtu_output.h"
 
@@ -87,6 +88,12 @@ namespace ryujin
 
     /**
      * Run the high-level time loop.
+     *
+     * The function can be called repeatedly, for example with different
+     * parameters parsed in between. If the parameters of the
+     * discretization and offline data subsections are unchanged since the
+     * last call (and the mesh has not been refined or loaded from a
+     * checkpoint) the mesh and the offline data are reused.
      */
     void run();
 
@@ -103,6 +110,8 @@ namespace ryujin
                 Number t,
                 unsigned int cycle);
 
+    std::string setup_signature() const;
+
     void print_parameters(std::ostream &stream);
     void print_mpi_partition(std::ostream &stream);
     void print_memory_statistics(std::ostream &stream);
@@ -154,6 +163,14 @@ namespace ryujin
 
     bool resume_;
 
+    bool enable_buddy_checkpointing_;
+    unsigned int buddy_checkpoint_interval_;
+    std::string buddy_checkpoint_directory_;
+
+    bool collect_performance_counters_;
+    bool measure_load_imbalance_;
+    bool measure_memory_bandwidth_;
+
     Number terminal_update_interval_;
 
     //@}
@@ -166,6 +183,37 @@ namespace ryujin
 
     std::map<std::string, dealii::Timer> computing_timer_;
 
+    double memory_bandwidth_; /* STREAM triad bandwidth in bytes/s */
+
+    /*
+     * Accumulated bytes and wall time of every section of the roofline
+     * report at the time of the last report, see print_throughput().
+     */
+    std::map<std::string, std::pair<double, double>> previous_traffic_;
+
+    /*
+     * Cycle, time and timer statistics at the time of the previous and
+     * the current throughput report, see print_throughput().
+     */
+    struct ThroughputData {
+      unsigned int cycle = 0;
+      double t = 0.;
+      double cpu_time_sum = 0.;
+      double cpu_time_avg = 0.;
+      double cpu_time_min = 0.;
+      double cpu_time_max = 0.;
+      double wall_time = 0.;
+    };
+    ThroughputData previous_throughput_;
+    ThroughputData current_throughput_;
+    double time_per_second_exp_;
+
+    /*
+     * The setup_signature() of the parameters the current mesh and offline
+     * data were created with, empty if they cannot be reused.
+     */
+    std::string setup_signature_;
+
     HyperbolicSystem hyperbolic_system_;
     ParabolicSystem parabolic_system_;
     Discretization<dim> discretization_;
@@ -177,6 +225,7 @@ namespace ryujin
     Postprocessor<Description, dim, Number> postprocessor_;
     VTUOutput<Description, dim, Number> vtu_output_;
     Quantities<Description, dim, Number> quantities_;
+    SolutionTransfer<Description, dim, Number> solution_transfer_;
 
     const unsigned int mpi_rank_;
     const unsigned int n_mpi_processes_;
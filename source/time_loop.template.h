@@ -6,9 +6,11 @@
 #pragma once
 
 #include "checkpointing.h"
+#include "instruction_set.h"
 #include "introspection.h"
+#include "load_imbalance.h"
+#include "roofline.h"
 #include "scope.h"
-#include "solution_transfer.h"
 #include "time_loop.h"
 
 #include <deal.II/base/logstream.h>
@@ -28,6 +30,8 @@ namespace ryujin
   TimeLoop<Description, dim, Number>::TimeLoop(const MPI_Comm &mpi_comm)
       : ParameterAcceptor("/A - TimeLoop")
       , mpi_communicator_(mpi_comm)
+      , memory_bandwidth_(0.)
+      , time_per_second_exp_(0.)
       , hyperbolic_system_("/B - Equation")
       , parabolic_system_("/B - Equation")
       , discretization_(mpi_communicator_, "/C - Discretization")
@@ -65,6 +69,7 @@ namespace ryujin
                     hyperbolic_system_,
                     offline_data_,
                     "/J - Quantities")
+      , solution_transfer_(offline_data_, hyperbolic_system_)
       , mpi_rank_(dealii::Utilities::MPI::this_mpi_process(mpi_communicator_))
       , n_mpi_processes_(
             dealii::Utilities::MPI::n_mpi_processes(mpi_communicator_))
@@ -97,6 +102,38 @@ namespace ryujin
         "at output granularity intervals. The frequency is determined by "
         "\"output granularity\" times \"output checkpoint multiplier\"");
 
+    enable_buddy_checkpointing_ = false;
+    add_parameter(
+        "enable buddy checkpointing",
+        enable_buddy_checkpointing_,
+        "Every \"buddy checkpoint interval\" cycles store the local part "
+        "of the state vector in a node-local directory and on a partner "
+        "rank. When resuming, buddy checkpoints take precedence over "
+        "regular checkpoints. The mesh is not stored but recreated by "
+        "redoing all global refinements, which requires the same number "
+        "of MPI ranks and rules out a random mesh distortion");
+
+    buddy_checkpoint_interval_ = 100;
+    add_parameter("buddy checkpoint interval",
+                  buddy_checkpoint_interval_,
+                  "Number of cycles between two buddy checkpoints (must be "
+                  "positive)");
+
+    const auto check_buddy_checkpoint_interval = [this]() {
+      AssertThrow(buddy_checkpoint_interval_ > 0,
+                  dealii::ExcMessage("The buddy checkpoint interval must be "
+                                     "positive. Use \"enable buddy "
+                                     "checkpointing = false\" to disable "
+                                     "buddy checkpoints."));
+    };
+    ParameterAcceptor::parse_parameters_call_back.connect(
+        check_buddy_checkpoint_interval);
+
+    buddy_checkpoint_directory_ = "/tmp";
+    add_parameter("buddy checkpoint directory",
+                  buddy_checkpoint_directory_,
+                  "Node-local directory for storing buddy checkpoints");
+
     enable_output_full_ = false;
     add_parameter("enable output full",
                   enable_output_full_,
@@ -168,6 +205,29 @@ namespace ryujin
     resume_ = false;
     add_parameter("resume", resume_, "Resume an interrupted computation");
 
+    collect_performance_counters_ = false;
+    add_parameter("collect performance counters",
+                  collect_performance_counters_,
+                  "Collect hardware performance counters (cycles, "
+                  "instructions, cache and branch misses) for all timer "
+                  "sections with perf_event_open(). The values are summed "
+                  "over all OpenMP threads; TBB worker threads are not "
+                  "included");
+
+    measure_load_imbalance_ = false;
+    add_parameter("measure load imbalance",
+                  measure_load_imbalance_,
+                  "Record per-thread busy and barrier wait times of the "
+                  "thread-parallel loops of the hyperbolic module and "
+                  "report the load imbalance among threads");
+
+    measure_memory_bandwidth_ = false;
+    add_parameter("measure memory bandwidth",
+                  measure_memory_bandwidth_,
+                  "Measure the memory bandwidth with a STREAM triad kernel "
+                  "at startup and report the achieved bandwidth of all "
+                  "phases of the hyperbolic module in relation to it");
+
     terminal_update_interval_ = 5;
     add_parameter("terminal update interval",
                   terminal_update_interval_,
@@ -187,20 +247,56 @@ namespace ryujin
                                     enable_output_full_ ||
                                     enable_output_levelsets_;
 
+    /*
+     * Reset timers, traffic estimates and solver statistics of a previous
+     * run (in batch mode):
+     */
+    for (auto &[name, timer] : computing_timer_)
+      timer.reset();
+    hyperbolic_module_.reset_traffic();
+    hyperbolic_module_.reset_statistics();
+    parabolic_module_.reset_statistics();
+    previous_traffic_.clear();
+    previous_throughput_ = ThroughputData();
+    current_throughput_ = ThroughputData();
+    time_per_second_exp_ = 0.;
+
     /* Attach log file: */
     if (mpi_rank_ == 0)
       logfile_.open(base_name_ + ".log");
 
+    /* The bandwidth is only measured once for repeated runs: */
+    if (!measure_memory_bandwidth_)
+      memory_bandwidth_ = 0.;
+    else if (memory_bandwidth_ == 0.)
+      memory_bandwidth_ = measure_memory_bandwidth(
+          mpi_communicator_, cache_capacity_per_rank(mpi_communicator_));
+
     print_parameters(logfile_);
 
+    if (collect_performance_counters_) {
+      const bool success = performance_counters().initialize();
+      if (!Utilities::MPI::logical_and(success, mpi_communicator_)) {
+        performance_counters().finalize();
+        print_info("performance counters are not available (check "
+                   "/proc/sys/kernel/perf_event_paranoid) - disabled");
+      }
+    }
+
+    load_imbalance().enable(measure_load_imbalance_);
+
     Number t = 0.;
     unsigned int output_cycle = 0;
     vector_type U;
 
+    /* The number of global refinements performed so far: */
+    unsigned int n_refinements = 0;
+
     /* Prepare data structures: */
 
-    const auto prepare_compute_kernels = [&]() {
-      offline_data_.prepare(problem_dimension);
+    const auto prepare_compute_kernels = [&](bool reuse_offline_data = false) {
+      if (!reuse_offline_data)
+        offline_data_.prepare(problem_dimension);
       hyperbolic_module_.prepare();
       parabolic_module_.prepare();
       time_integrator_.prepare();
@@ -215,9 +311,77 @@ namespace ryujin
       Scope scope(computing_timer_, "(re)initialize data structures");
       print_info("initializing data structures");
 
-      if (resume_) {
+      /*
+       * Buddy checkpoints do not store the mesh but recreate it, which
+       * is impossible for a randomly distorted mesh:
+       */
+      AssertThrow(!enable_buddy_checkpointing_ ||
+                      discretization_.mesh_distortion() == 0.,
+                  dealii::ExcMessage("Buddy checkpointing cannot be used "
+                                     "together with a random mesh "
+                                     "distortion."));
+
+      std::vector<char> buddy_checkpoint;
+      const bool resume_from_buddy_checkpoint =
+          resume_ && enable_buddy_checkpointing_ &&
+          Checkpointing::read_buddy_checkpoint(buddy_checkpoint_directory_,
+                                               base_name_,
+                                               buddy_checkpoint,
+                                               mpi_communicator_);
+
+      if (resume_ && enable_buddy_checkpointing_ &&
+          !resume_from_buddy_checkpoint)
+        print_info("no complete and consistent buddy checkpoint found");
+
+      bool resumed_from_buddy_checkpoint = false;
+      if (resume_from_buddy_checkpoint) {
+        const auto header =
+            Checkpointing::buddy_checkpoint_header(buddy_checkpoint);
+
+        print_info("resuming computation from buddy checkpoint: "
+                   "recreating mesh");
+        discretization_.prepare();
+        setup_signature_.clear();
+
+        /* Redo global refinements: */
+        auto &triangulation = discretization_.triangulation();
+        for (unsigned int k = 0; k < header.n_refinements; ++k)
+          triangulation.refine_global(1);
+
+        print_info("preparing compute kernels");
+        output_cycle = header.output_cycle;
+        prepare_compute_kernels();
+
+        print_info("resuming computation: loading state vector");
+        U.reinit(offline_data_.vector_partitioner());
+        resumed_from_buddy_checkpoint = Checkpointing::load_buddy_state_vector(
+            offline_data_, buddy_checkpoint, U, mpi_communicator_);
+
+        if (resumed_from_buddy_checkpoint) {
+          t = header.t;
+          t_initial_ = t;
+
+          /* Drop the timepoints of the global refinements we redid: */
+          n_refinements = header.n_refinements;
+          std::sort(t_refinements_.begin(), t_refinements_.end());
+          t_refinements_.erase(t_refinements_.begin(),
+                               t_refinements_.begin() +
+                                   std::min<std::size_t>(
+                                       n_refinements, t_refinements_.size()));
+        } else {
+          print_info("buddy checkpoint does not match the recreated mesh - "
+                     "falling back to regular checkpoint");
+          output_cycle = 0;
+        }
+      }
+
+      if (resumed_from_buddy_checkpoint) {
+        /* State vector, time and output cycle have been restored above. */
+
+      } else if (resume_) {
         print_info("resuming computation: recreating mesh");
         Checkpointing::load_mesh(discretization_, base_name_);
+        setup_signature_.clear();
 
         print_info("preparing compute kernels");
         prepare_compute_kernels();
@@ -236,15 +400,25 @@ namespace ryujin
             std::remove_if(t_refinements_.begin(),
                            t_refinements_.end(),
                            [&](const Number &t_ref) { return (t >= t_ref); });
+        n_refinements = std::distance(new_end, t_refinements_.end());
         t_refinements_.erase(new_end, t_refinements_.end());
 
       } else {
 
-        print_info("creating mesh");
-        discretization_.prepare();
+        const auto signature = setup_signature();
+        if (signature == setup_signature_) {
+          print_info("reusing mesh and offline data of the previous run");
+          print_info("preparing compute kernels");
+          prepare_compute_kernels(/* reuse offline data */ true);
 
-        print_info("preparing compute kernels");
-        prepare_compute_kernels();
+        } else {
+          print_info("creating mesh");
+          discretization_.prepare();
+
+          print_info("preparing compute kernels");
+          prepare_compute_kernels();
+          setup_signature_ = signature;
+        }
 
         print_info("interpolating initial values");
         U.reinit(offline_data_.vector_partitioner());
@@ -323,20 +497,19 @@ namespace ryujin
 
             print_info("performing global refinement");
 
-            SolutionTransfer<Description, dim, Number> solution_transfer(
-                offline_data_, hyperbolic_system_);
-
             auto &triangulation = discretization_.triangulation();
             for (auto &cell : triangulation.active_cell_iterators())
               cell->set_refine_flag();
             triangulation.prepare_coarsening_and_refinement();
 
-            solution_transfer.prepare_for_interpolation(U);
+            solution_transfer_.prepare_for_interpolation(U);
 
             triangulation.execute_coarsening_and_refinement();
             prepare_compute_kernels();
+            setup_signature_.clear();
 
-            solution_transfer.interpolate(U);
+            solution_transfer_.interpolate(U);
+            ++n_refinements;
 
             computing_timer_["time loop"].start();
             return true;
@@ -353,6 +526,19 @@ namespace ryujin
       const auto tau = time_integrator_.step(U, t, cycle);
       t += tau;
 
+      if (enable_buddy_checkpointing_ &&
+          cycle % buddy_checkpoint_interval_ == 0) {
+        Scope scope(computing_timer_, "time step [X] 5 - buddy checkpointing");
+        Checkpointing::write_buddy_checkpoint(offline_data_,
+                                              buddy_checkpoint_directory_,
+                                              base_name_,
+                                              U,
+                                              t,
+                                              n_refinements,
+                                              output_cycle,
+                                              mpi_communicator_);
+      }
+
       /* Print and record cycle statistics: */
 
       const bool write_to_log_file = (t >= output_cycle * output_granularity_);
@@ -386,12 +572,51 @@ namespace ryujin
       compute_error(U, t);
     }
 
+    /* Detach log file: */
+    if (mpi_rank_ == 0)
+      logfile_.close();
+
 #ifdef WITH_VALGRIND
     CALLGRIND_DUMP_STATS;
 #endif
   }
 
 
+  template <typename Description, int dim, typename Number>
+  std::string TimeLoop<Description, dim, Number>::setup_signature() const
+  {
+    /*
+     * Collect the (top level) subsections of the discretization and the
+     * offline data from the parameter handler. These determine the mesh
+     * and all offline data.
+     */
+
+    std::vector<std::string> subsections;
+    for (const auto &path : {discretization_.get_section_path(),
+                             offline_data_.get_section_path()})
+      subsections.push_back("subsection " + path.front());
+
+    std::ostringstream parameters;
+    ParameterAcceptor::prm.print_parameters(
+        parameters, ParameterHandler::OutputStyle::Short);
+
+    std::istringstream stream(parameters.str());
+    std::string signature;
+    bool active = false;
+    for (std::string line; std::getline(stream, line);) {
+      if (std::find(subsections.begin(), subsections.end(), line) !=
+          subsections.end())
+        active = true;
+      if (active)
+        signature += line + "\n";
+      if (line == "end")
+        active = false;
+    }
+
+    return signature;
+  }
+
+
   template <typename Description, int dim, typename Number>
   void TimeLoop<Description, dim, Number>::compute_error(
       const typename TimeLoop<Description, dim, Number>::vector_type &U,
@@ -635,6 +860,14 @@ namespace ryujin
     stream << "NUMBER == " << typeid(Number).name() << std::endl;
 
     stream << "SIMD width == " << VectorizedArray<Number>::size() << std::endl;
+    stream << "SIMD instruction set == "
+           << to_string(compiled_instruction_set()) << " (host: "
+           << to_string(detect_instruction_set()) << ")" << std::endl;
+
+    if (memory_bandwidth_ > 0.)
+      stream << "memory bandwidth (STREAM triad) == "
+             << std::setprecision(1) << std::fixed
+             << memory_bandwidth_ * 1.e-9 << " GB/s" << std::endl;
 
 #ifdef WITH_CUSTOM_POW
     stream << "serial pow == broadcasted pow(Vec4f)/pow(Vec2d)" << std::endl;
@@ -740,6 +973,21 @@ namespace ryujin
     Utilities::MPI::MinMaxAvg data =
         Utilities::MPI::min_max_avg(stats.VmRSS / 1024., mpi_communicator_);
 
+    /* Memory consumption of individual data structures: */
+
+    std::map<std::string, std::size_t> statistics;
+    offline_data_.memory_statistics(statistics);
+    hyperbolic_module_.memory_statistics(statistics);
+    parabolic_module_.memory_statistics(statistics);
+    time_integrator_.memory_statistics(statistics);
+    vtu_output_.memory_statistics(statistics);
+
+    std::vector<double> values;
+    for (const auto &it : statistics)
+      values.push_back(it.second / 1024. / 1024.);
+    const auto subsystem_data =
+        Utilities::MPI::min_max_avg(values, mpi_communicator_);
+
     if (mpi_rank_ != 0)
       return;
 
@@ -754,6 +1002,28 @@ namespace ryujin
            << std::setw(8) << data.max                        //
            << " [p" << std::setw(n) << data.max_index << "]"; //
 
+    /*
+     * For every data structure print min, avg, and max over all ranks,
+     * as well as the total summed over all ranks:
+     */
+
+    std::size_t width = 0;
+    for (const auto &it : statistics)
+      width = std::max(width, it.first.length());
+
+    auto jt = subsystem_data.begin();
+    for (const auto &it : statistics) {
+      const auto &entry = *jt++;
+      output << "\n  " << std::left << std::setw(width) << it.first
+             << std::right << std::setprecision(1) << std::fixed //
+             << std::setw(10) << entry.min                       //
+             << " [p" << std::setw(n) << entry.min_index << "] " //
+             << std::setw(8) << entry.avg << " "                 //
+             << std::setw(8) << entry.max                        //
+             << " [p" << std::setw(n) << entry.max_index << "]"  //
+             << "  (total " << entry.sum << ")";
+    }
+
     stream << output.str() << std::endl;
   }
 
@@ -834,12 +1104,80 @@ namespace ryujin
     }
     equalize();
 
+    if (performance_counters().enabled()) {
+      const double n_dofs = offline_data_.dof_handler().n_dofs();
+
+      const auto print_counters = [&](const std::string &section,
+                                      auto &stream) {
+        using Counters = PerformanceCounters;
+
+        std::vector<double> values(Counters::n_events + 1, 0.);
+        if (const auto data = performance_counters().get(section)) {
+          for (unsigned int k = 0; k < Counters::n_events; ++k)
+            values[k] = data->values[k];
+          values.back() = data->n_calls;
+        }
+        values = Utilities::MPI::sum(values, mpi_communicator_);
+
+        const double n_calls = values.back() / n_mpi_processes_;
+        if (values[Counters::cycles] == 0. || n_calls == 0.)
+          return;
+
+        const double per_dof = 1. / (n_calls * n_dofs);
+        stream << "[IPC " << std::setprecision(2) << std::fixed
+               << values[Counters::instructions] / values[Counters::cycles]
+               << ", LLC miss/DoF " << std::setprecision(3) << std::setw(7)
+               << values[Counters::cache_misses] * per_dof
+               << ", br miss/DoF " << std::setw(7)
+               << values[Counters::branch_misses] * per_dof << "]";
+      };
+
+      jt = output.begin();
+      for (auto &it : computing_timer_)
+        print_counters(it.first, *jt++);
+      equalize();
+    }
+
+    if (load_imbalance().enabled()) {
+      /*
+       * Report the ratio of maximal over mean busy time of all threads
+       * (maximum over all ranks) and the fraction of time threads spent
+       * waiting in barriers (average over all ranks):
+       */
+      const auto print_imbalance = [&](const std::string &section,
+                                       auto &stream) {
+        const auto imbalance = Utilities::MPI::max(
+            load_imbalance().imbalance(section), mpi_communicator_);
+        const auto wait_fraction =
+            Utilities::MPI::sum(load_imbalance().wait_fraction(section),
+                                mpi_communicator_) /
+            n_mpi_processes_;
+
+        if (imbalance == 0.)
+          return;
+
+        stream << "[thr imb " << std::setprecision(2) << std::fixed
+               << imbalance << ", wait " << std::setprecision(1)
+               << std::setw(4) << 100. * wait_fraction << "%]";
+      };
+
+      jt = output.begin();
+      for (auto &it : computing_timer_)
+        print_imbalance(it.first, *jt++);
+      equalize();
+    }
+
     if (mpi_rank_ != 0)
       return;
 
     stream << std::endl << "Timer statistics:\n";
     for (auto &it : output)
       stream << it.str() << std::endl;
+
+    if (performance_counters().enabled())
+      stream << "  (performance counters are summed over all OpenMP "
+                "threads, TBB worker threads are not included)"
+             << std::endl;
   }
 
 
@@ -847,21 +1185,8 @@ namespace ryujin
   void TimeLoop<Description, dim, Number>::print_throughput(
       unsigned int cycle, Number t, std::ostream &stream, bool final_time)
   {
-    /*
-     * Fixme: The global state kept in this function should be refactored
-     * into its own class object.
-     */
-    static struct Data {
-      unsigned int cycle = 0;
-      double t = 0.;
-      double cpu_time_sum = 0.;
-      double cpu_time_avg = 0.;
-      double cpu_time_min = 0.;
-      double cpu_time_max = 0.;
-      double wall_time = 0.;
-    } previous, current;
-
-    static double time_per_second_exp = 0.;
+    auto &previous = previous_throughput_;
+    auto &current = current_throughput_;
 
     /* Update statistics: */
 
@@ -884,7 +1209,7 @@ namespace ryujin
     }
 
     if (final_time)
-      previous = Data();
+      previous = ThroughputData();
 
     /* Take averages: */
 
@@ -968,10 +1293,68 @@ namespace ryujin
            << " dt/s) ]" << std::endl;
     /* clang-format on */
 
+    /* Print a roofline report for the phases of the hyperbolic module: */
+
+    {
+      if (final_time)
+        previous_traffic_.clear();
+
+      const auto &traffic = hyperbolic_module_.traffic();
+
+      std::vector<double> bytes;
+      std::vector<double> flops;
+      std::vector<double> wall_times;
+      for (const auto &[section, estimate] : traffic) {
+        bytes.push_back(estimate.bytes);
+        flops.push_back(estimate.flops);
+        wall_times.push_back(computing_timer_[section].wall_time());
+      }
+      bytes = Utilities::MPI::sum(bytes, mpi_communicator_);
+      flops = Utilities::MPI::sum(flops, mpi_communicator_);
+      wall_times = Utilities::MPI::max(wall_times, mpi_communicator_);
+
+      if (memory_bandwidth_ > 0. && !traffic.empty()) {
+        /* clang-format off */
+        output << "\n  Roofline (STREAM triad: "
+               << std::setprecision(1) << std::fixed
+               << memory_bandwidth_ * 1.e-9 << " GB/s):" << std::endl;
+        /* clang-format on */
+      }
+
+      unsigned int k = 0;
+      for (const auto &[section, estimate] : traffic) {
+        auto &previous = previous_traffic_[section];
+        const double delta_bytes = bytes[k] - previous.first;
+        const double delta_time = wall_times[k] - previous.second;
+        const double intensity = flops[k] / std::max(bytes[k], 1.);
+        previous = {bytes[k], wall_times[k]};
+        ++k;
+
+        if (memory_bandwidth_ <= 0. || delta_time <= 0.)
+          continue;
+
+        const double bandwidth = delta_bytes / delta_time;
+
+        /* Strip the "time step [H] n - " prefix: */
+        const auto pos = section.find(" - ");
+        const auto name =
+            pos == std::string::npos ? section : section.substr(pos + 3);
+
+        /* clang-format off */
+        output << "        [ " << std::left << std::setw(42) << name
+               << std::right << std::setprecision(1) << std::fixed
+               << std::setw(7) << bandwidth * 1.e-9 << " GB/s ("
+               << std::setw(5) << 100. * bandwidth / memory_bandwidth_
+               << "%)  "
+               << std::setprecision(2) << intensity << " flop/B ]" << std::endl;
+        /* clang-format on */
+      }
+    }
+
     /* and print an ETA */
-    time_per_second_exp = 0.8 * time_per_second_exp + 0.2 * time_per_second;
+    time_per_second_exp_ = 0.8 * time_per_second_exp_ + 0.2 * time_per_second;
     auto eta = static_cast<unsigned int>(std::max(t_final_ - t, Number(0.)) /
-                                         time_per_second_exp);
+                                         time_per_second_exp_);
 
     output << "\n  ETA : ";
 
@@ -7,12 +7,38 @@
 #pragma once
 
 #include <deal.II/base/config.h>
+#include <deal.II/base/geometry_info.h>
 #include <deal.II/grid/manifold.h>
 
+#include <array>
+
 namespace ryujin
 {
   using namespace dealii; // FIXME: namespace pollution
 
+  namespace internal
+  {
+    /**
+     * Geometry information of a coarse cell cached by
+     * TransfiniteInterpolationManifold: The vertices of the cell and, for
+     * every line and face, the manifold to query if it differs from the
+     * manifold of the cell (and a nullptr otherwise).
+     */
+    template <int dim, int spacedim>
+    struct TransfiniteCellData {
+      std::array<Point<spacedim>, GeometryInfo<dim>::vertices_per_cell>
+          vertices;
+      std::array<const Manifold<dim, spacedim> *,
+                 GeometryInfo<dim>::lines_per_cell>
+          line_manifolds;
+      std::array<const Manifold<dim, spacedim> *,
+                 GeometryInfo<dim>::faces_per_cell>
+          face_manifolds;
+      double diameter;
+      bool is_flat;
+    };
+  } // namespace internal
+
   /**
    * This is a copy of the TransfiniteInterpolationManifold shipped with
    * deal.II. In contrast to the deal.II version it copies the coarse grid
@@ -50,25 +76,37 @@ namespace ryujin
         const ArrayView<const Point<spacedim>> &surrounding_points,
         ArrayView<Point<dim>> chart_points) const;
 
-    Point<dim>
+    /**
+     * Pull back all @p points to the chart of the coarse cell @p cell,
+     * starting from @p initial_guesses. All points are iterated
+     * simultaneously: The function evaluations requested by the
+     * individual quasi-Newton iterations are collected and evaluated in
+     * SIMD batches. Points for which the iteration fails are set to
+     * internal::invalid_pull_back_coordinate.
+     */
+    void
     pull_back(const typename Triangulation<dim, spacedim>::cell_iterator &cell,
-              const Point<spacedim> &p,
-              const Point<dim> &initial_guess) const;
+              const ArrayView<const Point<spacedim>> &points,
+              const ArrayView<const Point<dim>> &initial_guesses,
+              const ArrayView<Point<dim>> &chart_points) const;
 
     Point<spacedim> push_forward(
         const typename Triangulation<dim, spacedim>::cell_iterator &cell,
         const Point<dim> &chart_point) const;
 
-    DerivativeForm<1, dim, spacedim> push_forward_gradient(
+    /**
+     * Push forward all @p chart_points in SIMD batches.
+     */
+    void push_forward(
         const typename Triangulation<dim, spacedim>::cell_iterator &cell,
-        const Point<dim> &chart_point,
-        const Point<spacedim> &pushed_forward_chart_point) const;
+        const ArrayView<const Point<dim>> &chart_points,
+        const ArrayView<Point<spacedim>> &new_points) const;
 
     Triangulation<dim, spacedim> triangulation;
 
     int level_coarse;
 
-    std::vector<bool> coarse_cell_is_flat;
+    std::vector<internal::TransfiniteCellData<dim, spacedim>> coarse_cell_data;
 
     std::unique_ptr<Manifold<dim, spacedim>> chart_manifold;
   };
@@ -11,6 +11,7 @@
 #include <boost/container/small_vector.hpp>
 
 #include <deal.II/base/table.h>
+#include <deal.II/base/vectorization.h>
 
 namespace ryujin
 {
@@ -52,73 +53,141 @@ namespace ryujin
     this->chart_manifold = chart_manifold.clone();
 
     level_coarse = triangulation.last()->level();
-    coarse_cell_is_flat.resize(triangulation.n_cells(level_coarse), false);
+
+    // cache the vertices and the manifolds of all lines and faces that
+    // differ from the manifold of the cell
+    coarse_cell_data.resize(triangulation.n_cells(level_coarse));
     typename Triangulation<dim, spacedim>::active_cell_iterator
         cell = triangulation.begin(level_coarse),
         endc = triangulation.end(level_coarse);
     for (; cell != endc; ++cell) {
+      AssertIndexRange(static_cast<unsigned int>(cell->index()),
+                       coarse_cell_data.size());
+      auto &data = coarse_cell_data[cell->index()];
+
+      const auto get_manifold =
+          [&](const types::manifold_id manifold_id)
+          -> const Manifold<dim, spacedim> * {
+        if (manifold_id == cell->manifold_id() ||
+            manifold_id == numbers::flat_manifold_id)
+          return nullptr;
+        return &triangulation.get_manifold(manifold_id);
+      };
+
       bool cell_is_flat = true;
-      for (unsigned int l = 0; l < GeometryInfo<dim>::lines_per_cell; ++l)
-        if (cell->line(l)->manifold_id() != cell->manifold_id() &&
-            cell->line(l)->manifold_id() != numbers::flat_manifold_id)
+      for (const unsigned int v : GeometryInfo<dim>::vertex_indices())
+        data.vertices[v] = cell->vertex(v);
+      for (unsigned int l = 0; l < GeometryInfo<dim>::lines_per_cell; ++l) {
+        data.line_manifolds[l] = get_manifold(cell->line(l)->manifold_id());
+        if (data.line_manifolds[l] != nullptr)
           cell_is_flat = false;
-      if (dim > 2)
-        for (unsigned int q = 0; q < GeometryInfo<dim>::quads_per_cell; ++q)
-          if (cell->quad(q)->manifold_id() != cell->manifold_id() &&
-              cell->quad(q)->manifold_id() != numbers::flat_manifold_id)
-            cell_is_flat = false;
-      AssertIndexRange(static_cast<unsigned int>(cell->index()),
-                       coarse_cell_is_flat.size());
-      coarse_cell_is_flat[cell->index()] = cell_is_flat;
+      }
+      for (const unsigned int f : GeometryInfo<dim>::face_indices()) {
+        data.face_manifolds[f] = get_manifold(cell->face(f)->manifold_id());
+        if (data.face_manifolds[f] != nullptr)
+          cell_is_flat = false;
+      }
+      data.diameter = cell->diameter();
+      data.is_flat = cell_is_flat;
     }
   }
 
 
   namespace
   {
+    /*
+     * Helper functions for accessing the lanes of a (possibly) vectorized
+     * number: the interpolation below is written for double and
+     * VectorizedArray<double> alike.
+     */
+
+    template <typename Number>
+    constexpr unsigned int n_lanes = 1;
+
+    template <typename T, std::size_t width>
+    constexpr unsigned int n_lanes<VectorizedArray<T, width>> = width;
+
+    DEAL_II_ALWAYS_INLINE inline double &lane(double &x, const unsigned int)
+    {
+      return x;
+    }
+
+    DEAL_II_ALWAYS_INLINE inline double lane(const double &x,
+                                             const unsigned int)
+    {
+      return x;
+    }
+
+    template <typename T, std::size_t width>
+    DEAL_II_ALWAYS_INLINE inline T &lane(VectorizedArray<T, width> &x,
+                                         const unsigned int l)
+    {
+      return x[l];
+    }
+
+    template <typename T, std::size_t width>
+    DEAL_II_ALWAYS_INLINE inline T lane(const VectorizedArray<T, width> &x,
+                                        const unsigned int l)
+    {
+      return x[l];
+    }
+
+    /* Set all lanes with an absolute value below 1e-13 to zero: */
+    template <typename Number>
+    DEAL_II_ALWAYS_INLINE inline Number zero_if_small(const Number &x)
+    {
+      return compare_and_apply_mask<SIMDComparison::less_than>(
+          std::abs(x), Number(1e-13), Number(0.), x);
+    }
+
+    template <typename Number>
+    DEAL_II_ALWAYS_INLINE inline bool all_zero(const Number &x)
+    {
+      for (unsigned int l = 0; l < n_lanes<Number>; ++l)
+        if (lane(x, l) != 0.)
+          return false;
+      return true;
+    }
+
     // version for 1D
-    template <typename AccessorType>
-    Point<AccessorType::space_dimension>
-    compute_transfinite_interpolation(const AccessorType &cell,
-                                      const Point<1> &chart_point,
-                                      const bool /*cell_is_flat*/)
+    template <int spacedim, typename Number>
+    Point<spacedim, Number> compute_transfinite_interpolation(
+        const internal::TransfiniteCellData<1, spacedim> &data,
+        const Point<1, Number> &chart_point)
     {
-      return cell.vertex(0) * (1. - chart_point[0]) +
-             cell.vertex(1) * chart_point[0];
+      Point<spacedim, Number> new_point;
+      for (unsigned int e = 0; e < spacedim; ++e)
+        new_point[e] = (Number(1.) - chart_point[0]) * data.vertices[0][e] +
+                       chart_point[0] * data.vertices[1][e];
+      return new_point;
     }
 
     // version for 2D
-    template <typename AccessorType>
-    Point<AccessorType::space_dimension>
-    compute_transfinite_interpolation(const AccessorType &cell,
-                                      const Point<2> &chart_point,
-                                      const bool cell_is_flat)
+    template <int spacedim, typename Number>
+    Point<spacedim, Number> compute_transfinite_interpolation(
+        const internal::TransfiniteCellData<2, spacedim> &data,
+        const Point<2, Number> &chart_point)
     {
-      const unsigned int dim = AccessorType::dimension;
-      const unsigned int spacedim = AccessorType::space_dimension;
-      const types::manifold_id my_manifold_id = cell.manifold_id();
-      const Triangulation<dim, spacedim> &tria = cell.get_triangulation();
-
       // formula see wikipedia
       // https://en.wikipedia.org/wiki/Transfinite_interpolation
       // S(u,v) = (1-v)c_1(u)+v c_3(u) + (1-u)c_2(v) + u c_4(v) -
       //   [(1-u)(1-v)P_0 + u(1-v) P_1 + (1-u)v P_2 + uv P_3]
-      const std::array<Point<spacedim>, 4> vertices{
-          {cell.vertex(0), cell.vertex(1), cell.vertex(2), cell.vertex(3)}};
+      const auto &vertices = data.vertices;
 
       // this evaluates all bilinear shape functions because we need them
       // repeatedly. we will update this values in the complicated case with
       // curved lines below
-      std::array<double, 4> weights_vertices{
-          {(1. - chart_point[0]) * (1. - chart_point[1]),
-           chart_point[0] * (1. - chart_point[1]),
-           (1. - chart_point[0]) * chart_point[1],
+      std::array<Number, 4> weights_vertices{
+          {(Number(1.) - chart_point[0]) * (Number(1.) - chart_point[1]),
+           chart_point[0] * (Number(1.) - chart_point[1]),
+           (Number(1.) - chart_point[0]) * chart_point[1],
            chart_point[0] * chart_point[1]}};
 
-      Point<spacedim> new_point;
-      if (cell_is_flat)
+      Point<spacedim, Number> new_point;
+      if (data.is_flat)
         for (const unsigned int v : GeometryInfo<2>::vertex_indices())
-          new_point += weights_vertices[v] * vertices[v];
+          for (unsigned int e = 0; e < spacedim; ++e)
+            new_point[e] += weights_vertices[v] * vertices[v][e];
       else {
         // The second line in the formula tells us to subtract the
         // contribution of the vertices.  If a line employs the same manifold
@@ -138,20 +207,19 @@ namespace ryujin
 
         for (unsigned int line = 0; line < GeometryInfo<2>::lines_per_cell;
              ++line) {
-          const double my_weight =
-              (line % 2) ? chart_point[line / 2] : 1 - chart_point[line / 2];
-          const double line_point = chart_point[1 - line / 2];
+          const Number my_weight = (line % 2) ? chart_point[line / 2]
+                                              : Number(1.) -
+                                                    chart_point[line / 2];
+          const Number line_point = chart_point[1 - line / 2];
 
           // Same manifold or invalid id which will go back to the same
           // class -> contribution should be added for the final point,
           // which means that we subtract the current weight from the
           // negative weight applied to the vertex
-          const types::manifold_id line_manifold_id =
-              cell.line(line)->manifold_id();
-          if (line_manifold_id == my_manifold_id ||
-              line_manifold_id == numbers::flat_manifold_id) {
+          const auto line_manifold = data.line_manifolds[line];
+          if (line_manifold == nullptr) {
             weights_vertices[GeometryInfo<2>::line_to_cell_vertices(line, 0)] -=
-                my_weight * (1. - line_point);
+                my_weight * (Number(1.) - line_point);
             weights_vertices[GeometryInfo<2>::line_to_cell_vertices(line, 1)] -=
                 my_weight * line_point;
           } else {
@@ -159,17 +227,22 @@ namespace ryujin
                 vertices[GeometryInfo<2>::line_to_cell_vertices(line, 0)];
             points[1] =
                 vertices[GeometryInfo<2>::line_to_cell_vertices(line, 1)];
-            weights[0] = 1. - line_point;
-            weights[1] = line_point;
-            new_point +=
-                my_weight * tria.get_manifold(line_manifold_id)
-                                .get_new_point(points_view, weights_view);
+            // the line manifold is queried one lane at a time
+            for (unsigned int l = 0; l < n_lanes<Number>; ++l) {
+              weights[0] = 1. - lane(line_point, l);
+              weights[1] = lane(line_point, l);
+              const auto line_new_point =
+                  line_manifold->get_new_point(points_view, weights_view);
+              for (unsigned int e = 0; e < spacedim; ++e)
+                lane(new_point[e], l) += lane(my_weight, l) * line_new_point[e];
+            }
           }
         }
 
         // subtract contribution from the vertices (second line in formula)
         for (const unsigned int v : GeometryInfo<2>::vertex_indices())
-          new_point -= weights_vertices[v] * vertices[v];
+          for (unsigned int e = 0; e < spacedim; ++e)
+            new_point[e] -= weights_vertices[v] * vertices[v][e];
       }
 
       return new_point;
@@ -197,34 +270,21 @@ namespace ryujin
                                                                  {4, 5, 6, 7}};
 
     // version for 3D
-    template <typename AccessorType>
-    Point<AccessorType::space_dimension>
-    compute_transfinite_interpolation(const AccessorType &cell,
-                                      const Point<3> &chart_point,
-                                      const bool cell_is_flat)
+    template <int spacedim, typename Number>
+    Point<spacedim, Number> compute_transfinite_interpolation(
+        const internal::TransfiniteCellData<3, spacedim> &data,
+        const Point<3, Number> &chart_point)
     {
-      const unsigned int dim = AccessorType::dimension;
-      const unsigned int spacedim = AccessorType::space_dimension;
-      const types::manifold_id my_manifold_id = cell.manifold_id();
-      const Triangulation<dim, spacedim> &tria = cell.get_triangulation();
-
       // Same approach as in 2D, but adding the faces, subtracting the edges,
       // and adding the vertices
-      const std::array<Point<spacedim>, 8> vertices{{cell.vertex(0),
-                                                     cell.vertex(1),
-                                                     cell.vertex(2),
-                                                     cell.vertex(3),
-                                                     cell.vertex(4),
-                                                     cell.vertex(5),
-                                                     cell.vertex(6),
-                                                     cell.vertex(7)}};
+      const auto &vertices = data.vertices;
 
       // store the components of the linear shape functions because we need them
       // repeatedly. we allow for 10 such shape functions to wrap around the
       // first four once again for easier face access.
-      double linear_shapes[10];
+      Number linear_shapes[10];
       for (unsigned int d = 0; d < 3; ++d) {
-        linear_shapes[2 * d] = 1. - chart_point[d];
+        linear_shapes[2 * d] = Number(1.) - chart_point[d];
         linear_shapes[2 * d + 1] = chart_point[d];
       }
 
@@ -232,7 +292,7 @@ namespace ryujin
       for (unsigned int d = 6; d < 10; ++d)
         linear_shapes[d] = linear_shapes[d - 6];
 
-      std::array<double, 8> weights_vertices;
+      std::array<Number, 8> weights_vertices;
       for (unsigned int i2 = 0, v = 0; i2 < 2; ++i2)
         for (unsigned int i1 = 0; i1 < 2; ++i1)
           for (unsigned int i0 = 0; i0 < 2; ++i0, ++v)
@@ -240,16 +300,17 @@ namespace ryujin
                 (linear_shapes[4 + i2] * linear_shapes[2 + i1]) *
                 linear_shapes[i0];
 
-      Point<spacedim> new_point;
-      if (cell_is_flat)
+      Point<spacedim, Number> new_point;
+      if (data.is_flat)
         for (unsigned int v = 0; v < 8; ++v)
-          new_point += weights_vertices[v] * vertices[v];
+          for (unsigned int e = 0; e < spacedim; ++e)
+            new_point[e] += weights_vertices[v] * vertices[v][e];
       else {
         // identify the weights for the lines to be accumulated (vertex
         // weights are set outside and coincide with the flat manifold case)
 
-        std::array<double, GeometryInfo<3>::lines_per_cell> weights_lines;
-        std::fill(weights_lines.begin(), weights_lines.end(), 0.0);
+        std::array<Number, GeometryInfo<3>::lines_per_cell> weights_lines;
+        std::fill(weights_lines.begin(), weights_lines.end(), Number(0.));
 
         // start with the contributions of the faces
         std::array<double, GeometryInfo<2>::vertices_per_cell> weights;
@@ -260,21 +321,21 @@ namespace ryujin
         const auto points_view = make_array_view(points.begin(), points.end());
 
         for (const unsigned int face : GeometryInfo<3>::face_indices()) {
-          const double my_weight = linear_shapes[face];
+          // lanes with a vanishing weight do not contribute: setting the
+          // weight to zero is equivalent to skipping the face
+          const Number my_weight = zero_if_small(linear_shapes[face]);
           const unsigned int face_even = face - face % 2;
 
-          if (std::abs(my_weight) < 1e-13)
+          if (all_zero(my_weight))
             continue;
 
           // same manifold or invalid id which will go back to the same class
           // -> face will interpolate from the surrounding lines and vertices
-          const types::manifold_id face_manifold_id =
-              cell.face(face)->manifold_id();
-          if (face_manifold_id == my_manifold_id ||
-              face_manifold_id == numbers::flat_manifold_id) {
+          const auto face_manifold = data.face_manifolds[face];
+          if (face_manifold == nullptr) {
             for (unsigned int line = 0; line < GeometryInfo<2>::lines_per_cell;
                  ++line) {
-              const double line_weight = linear_shapes[face_even + 2 + line];
+              const Number line_weight = linear_shapes[face_even + 2 + line];
               weights_lines[face_to_cell_lines_3d[face][line]] +=
                   my_weight * line_weight;
             }
@@ -297,17 +358,23 @@ namespace ryujin
           } else {
             for (const unsigned int v : GeometryInfo<2>::vertex_indices())
               points[v] = vertices[face_to_cell_vertices_3d[face][v]];
-            weights[0] =
-                linear_shapes[face_even + 2] * linear_shapes[face_even + 4];
-            weights[1] =
-                linear_shapes[face_even + 3] * linear_shapes[face_even + 4];
-            weights[2] =
-                linear_shapes[face_even + 2] * linear_shapes[face_even + 5];
-            weights[3] =
-                linear_shapes[face_even + 3] * linear_shapes[face_even + 5];
-            new_point +=
-                my_weight * tria.get_manifold(face_manifold_id)
-                                .get_new_point(points_view, weights_view);
+            // the face manifold is queried one lane at a time
+            for (unsigned int l = 0; l < n_lanes<Number>; ++l) {
+              if (lane(my_weight, l) == 0.)
+                continue;
+              const double s2 = lane(linear_shapes[face_even + 2], l);
+              const double s3 = lane(linear_shapes[face_even + 3], l);
+              const double s4 = lane(linear_shapes[face_even + 4], l);
+              const double s5 = lane(linear_shapes[face_even + 5], l);
+              weights[0] = s2 * s4;
+              weights[1] = s3 * s4;
+              weights[2] = s2 * s5;
+              weights[3] = s3 * s5;
+              const auto face_new_point =
+                  face_manifold->get_new_point(points_view, weights_view);
+              for (unsigned int e = 0; e < spacedim; ++e)
+                lane(new_point[e], l) += lane(my_weight, l) * face_new_point[e];
+            }
           }
         }
 
@@ -318,9 +385,9 @@ namespace ryujin
             make_array_view(points.begin(), points.begin() + 2);
         for (unsigned int line = 0; line < GeometryInfo<3>::lines_per_cell;
              ++line) {
-          const double line_point =
+          const Number line_point =
               (line < 8 ? chart_point[1 - (line % 4) / 2] : chart_point[2]);
-          double my_weight = 0.;
+          Number my_weight = Number(0.);
           if (line < 8)
             my_weight = linear_shapes[line % 4] * linear_shapes[4 + line / 4];
           else {
@@ -329,16 +396,15 @@ namespace ryujin
                 linear_shapes[subline % 2] * linear_shapes[2 + subline / 2];
           }
           my_weight -= weights_lines[line];
+          my_weight = zero_if_small(my_weight);
 
-          if (std::abs(my_weight) < 1e-13)
+          if (all_zero(my_weight))
             continue;
 
-          const types::manifold_id line_manifold_id =
-              cell.line(line)->manifold_id();
-          if (line_manifold_id == my_manifold_id ||
-              line_manifold_id == numbers::flat_manifold_id) {
+          const auto line_manifold = data.line_manifolds[line];
+          if (line_manifold == nullptr) {
             weights_vertices[GeometryInfo<3>::line_to_cell_vertices(line, 0)] -=
-                my_weight * (1. - line_point);
+                my_weight * (Number(1.) - line_point);
             weights_vertices[GeometryInfo<3>::line_to_cell_vertices(line, 1)] -=
                 my_weight * (line_point);
           } else {
@@ -346,17 +412,23 @@ namespace ryujin
                 vertices[GeometryInfo<3>::line_to_cell_vertices(line, 0)];
             points[1] =
                 vertices[GeometryInfo<3>::line_to_cell_vertices(line, 1)];
-            weights[0] = 1. - line_point;
-            weights[1] = line_point;
-            new_point -= my_weight * tria.get_manifold(line_manifold_id)
-                                         .get_new_point(points_view_line,
-                                                        weights_view_line);
+            for (unsigned int l = 0; l < n_lanes<Number>; ++l) {
+              if (lane(my_weight, l) == 0.)
+                continue;
+              weights[0] = 1. - lane(line_point, l);
+              weights[1] = lane(line_point, l);
+              const auto line_new_point = line_manifold->get_new_point(
+                  points_view_line, weights_view_line);
+              for (unsigned int e = 0; e < spacedim; ++e)
+                lane(new_point[e], l) -= lane(my_weight, l) * line_new_point[e];
+            }
           }
         }
 
         // finally add the contribution of the
-        for (const unsigned int v : GeometryInfo<dim>::vertex_indices())
-          new_point += weights_vertices[v] * vertices[v];
+        for (unsigned int v = 0; v < 8; ++v)
+          for (unsigned int e = 0; e < spacedim; ++e)
+            new_point[e] += weights_vertices[v] * vertices[v][e];
       }
       return new_point;
     }
@@ -376,132 +448,150 @@ namespace ryujin
     Assert(GeometryInfo<dim>::is_inside_unit_cell(chart_point, 5e-4),
            ExcMessage("chart_point is not in unit interval"));
 
-    return compute_transfinite_interpolation(
-        *cell, chart_point, coarse_cell_is_flat[cell->index()]);
+    return compute_transfinite_interpolation(coarse_cell_data[cell->index()],
+                                             chart_point);
   }
 
 
   template <int dim, int spacedim>
-  DerivativeForm<1, dim, spacedim>
-  TransfiniteInterpolationManifold<dim, spacedim>::push_forward_gradient(
+  void TransfiniteInterpolationManifold<dim, spacedim>::push_forward(
       const typename Triangulation<dim, spacedim>::cell_iterator &cell,
-      const Point<dim> &chart_point,
-      const Point<spacedim> &pushed_forward_chart_point) const
+      const ArrayView<const Point<dim>> &chart_points,
+      const ArrayView<Point<spacedim>> &new_points) const
   {
-    // compute the derivative with the help of finite differences
-    DerivativeForm<1, dim, spacedim> grad;
-    for (unsigned int d = 0; d < dim; ++d) {
-      Point<dim> modified = chart_point;
-      const double step = chart_point[d] > 0.5 ? -1e-8 : 1e-8;
-
-      // avoid checking outside of the unit interval
-      modified[d] += step;
-      Tensor<1, spacedim> difference =
-          compute_transfinite_interpolation(
-              *cell, modified, coarse_cell_is_flat[cell->index()]) -
-          pushed_forward_chart_point;
-      for (unsigned int e = 0; e < spacedim; ++e)
-        grad[e][d] = difference[e] / step;
+    AssertDimension(cell->level(), level_coarse);
+    AssertDimension(chart_points.size(), new_points.size());
+
+    using VA = VectorizedArray<double>;
+    constexpr unsigned int width = VA::size();
+
+    const auto &data = coarse_cell_data[cell->index()];
+    const unsigned int n_points = chart_points.size();
+
+    for (unsigned int i = 0; i < n_points; i += width) {
+      const unsigned int n_filled = std::min(width, n_points - i);
+
+      // fill unused lanes with the last point of the batch in order to
+      // only query the manifolds at valid chart points
+      Point<dim, VA> chart_point;
+      for (unsigned int l = 0; l < width; ++l)
+        for (unsigned int d = 0; d < dim; ++d)
+          chart_point[d][l] = chart_points[i + std::min(l, n_filled - 1)][d];
+
+      const auto new_point =
+          compute_transfinite_interpolation(data, chart_point);
+
+      for (unsigned int l = 0; l < n_filled; ++l)
+        for (unsigned int e = 0; e < spacedim; ++e)
+          new_points[i + l][e] = new_point[e][l];
     }
-    return grad;
   }
 
 
   template <int dim, int spacedim>
-  Point<dim> TransfiniteInterpolationManifold<dim, spacedim>::pull_back(
+  void TransfiniteInterpolationManifold<dim, spacedim>::pull_back(
       const typename Triangulation<dim, spacedim>::cell_iterator &cell,
-      const Point<spacedim> &point,
-      const Point<dim> &initial_guess) const
+      const ArrayView<const Point<spacedim>> &points,
+      const ArrayView<const Point<dim>> &initial_guesses,
+      const ArrayView<Point<dim>> &chart_points) const
   {
+    AssertDimension(points.size(), initial_guesses.size());
+    AssertDimension(points.size(), chart_points.size());
+
+    const unsigned int n_points = points.size();
+
     Point<dim> outside;
     for (unsigned int d = 0; d < dim; ++d)
       outside[d] = internal::invalid_pull_back_coordinate;
 
+    const double diameter = coarse_cell_data[cell->index()].diameter;
+    const double tolerance = 1e-21 * Utilities::fixed_power<2>(diameter);
+
+    // We run a quasi-Newton iteration with a combination of finite
+    // differences for the exact Jacobian and "Broyden's good method" for
+    // every point. As opposed to the various mapping implementations, this
+    // class does not throw exception upon failure as those are relatively
+    // expensive and failure occurs quite regularly in the implementation
+    // of the compute_chart_points method.
+    //
+    // The iterations of all points are advanced simultaneously: Every
+    // point runs its (cheap) control logic until it needs a function
+    // evaluation (for the finite-difference Jacobian or the line search).
+    // All requested evaluations are then done in SIMD batches by
+    // push_forward(). Points that have converged or failed are masked
+    // out by their stage.
+
+    enum class Stage { iterate, jacobian, line_search, done };
+
+    struct State {
+      Point<dim> chart_point;
+      Tensor<1, spacedim> residual;
+      double residual_norm_square;
+      DerivativeForm<1, dim, spacedim> inv_grad;
+      bool must_recompute_jacobian = true;
+      unsigned int iteration = 0;
+      Tensor<1, dim> update;
+      double alpha = 1.;
+      Tensor<1, spacedim> old_residual;
+      Stage stage = Stage::iterate;
+    };
+
+    boost::container::small_vector<State, 26> states(n_points);
+    boost::container::small_vector<Point<dim>, 100> requests;
+    boost::container::small_vector<Point<spacedim>, 100> results;
+
+    const auto evaluate_requests = [&]() {
+      results.resize(requests.size());
+      push_forward(cell,
+                   make_array_view(requests.begin(), requests.end()),
+                   make_array_view(results.begin(), results.end()));
+    };
+
     // project the user-given input to unit cell
-    Point<dim> chart_point =
-        GeometryInfo<dim>::project_to_unit_cell(initial_guess);
-
-    // run quasi-Newton iteration with a combination of finite differences for
-    // the exact Jacobian and "Broyden's good method". As opposed to the various
-    // mapping implementations, this class does not throw exception upon failure
-    // as those are relatively expensive and failure occurs quite regularly in
-    // the implementation of the compute_chart_points method.
-    Tensor<1, spacedim> residual =
-        point - compute_transfinite_interpolation(
-                    *cell, chart_point, coarse_cell_is_flat[cell->index()]);
-    const double tolerance =
-        1e-21 * Utilities::fixed_power<2>(cell->diameter());
-    double residual_norm_square = residual.norm_square();
-    DerivativeForm<1, dim, spacedim> inv_grad;
-    bool must_recompute_jacobian = true;
-    for (unsigned int i = 0; i < 100; ++i) {
-      if (residual_norm_square < tolerance) {
-        // do a final update of the point with the last available Jacobian
-        // information. The residual is close to zero due to the check
-        // above, but me might improve some of the last digits by a final
-        // Newton-like step with step length 1
-        Tensor<1, dim> update;
-        for (unsigned int d = 0; d < spacedim; ++d)
-          for (unsigned int e = 0; e < dim; ++e)
-            update[e] += inv_grad[d][e] * residual[d];
-        return chart_point + update;
-      }
+    for (unsigned int i = 0; i < n_points; ++i) {
+      states[i].chart_point =
+          GeometryInfo<dim>::project_to_unit_cell(initial_guesses[i]);
+      requests.push_back(states[i].chart_point);
+    }
+    evaluate_requests();
+    for (unsigned int i = 0; i < n_points; ++i) {
+      states[i].residual = points[i] - results[i];
+      states[i].residual_norm_square = states[i].residual.norm_square();
+    }
 
-      // every 9 iterations, including the first time around, we create an
-      // approximation of the Jacobian with finite differences. Broyden's
-      // method usually does not need more than 5-8 iterations, but sometimes
-      // we might have had a bad initial guess and then we can accelerate
-      // convergence considerably with getting the actual Jacobian rather than
-      // using secant-like methods (one gradient calculation in 3D costs as
-      // much as 3 more iterations). this usually happens close to convergence
-      // and one more step with the finite-differenced Jacobian leads to
-      // convergence. however, we should not make the update too close to
-      // termination either because of cancellation effects an finite
-      // difference accuracy.
-      if (must_recompute_jacobian ||
-          (residual_norm_square > 1e4 * tolerance && i % 7 == 0)) {
-        // if the determinant is zero or negative, the mapping is either not
-        // invertible or already has inverted and we are outside the valid
-        // chart region. Note that the Jacobian here represents the
-        // derivative of the forward map and should have a positive
-        // determinant since we use properly oriented meshes.
-        DerivativeForm<1, dim, spacedim> grad = push_forward_gradient(
-            cell, chart_point, Point<spacedim>(point - residual));
-        if (grad.determinant() <= 0.0)
-          return outside;
-        inv_grad = grad.covariant_form();
-        must_recompute_jacobian = false;
-      }
+    const auto compute_update = [&](const State &state) {
       Tensor<1, dim> update;
       for (unsigned int d = 0; d < spacedim; ++d)
         for (unsigned int e = 0; e < dim; ++e)
-          update[e] += inv_grad[d][e] * residual[d];
+          update[e] += state.inv_grad[d][e] * state.residual[d];
+      return update;
+    };
+
+    const auto finish = [&](State &state,
+                            const unsigned int i,
+                            const Point<dim> &chart_point) {
+      chart_points[i] = chart_point;
+      state.stage = Stage::done;
+    };
+
+    const auto start_line_search = [&](State &state) {
+      state.update = compute_update(state);
 
       // Line search, accept step if the residual has decreased
-      double alpha = 1.;
+      state.alpha = 1.;
 
       // check if point is inside 1.2 times the unit cell to avoid
       // hitting points very far away from valid ones in the manifolds
       while (!GeometryInfo<dim>::is_inside_unit_cell(
-                 chart_point + alpha * update, 0.2) &&
-             alpha > 1e-7)
-        alpha *= 0.5;
-
-      const Tensor<1, spacedim> old_residual = residual;
-      while (alpha > 1e-4) {
-        Point<dim> guess = chart_point + alpha * update;
-        const Tensor<1, dim> residual_guess =
-            point - compute_transfinite_interpolation(
-                        *cell, guess, coarse_cell_is_flat[cell->index()]);
-        const double residual_norm_new = residual_guess.norm_square();
-        if (residual_norm_new < residual_norm_square) {
-          residual_norm_square = residual_norm_new;
-          chart_point += alpha * update;
-          residual = residual_guess;
-          break;
-        } else
-          alpha *= 0.5;
-      }
+                 state.chart_point + state.alpha * state.update, 0.2) &&
+             state.alpha > 1e-7)
+        state.alpha *= 0.5;
+
+      state.old_residual = state.residual;
+      state.stage = Stage::line_search;
+    };
+
+    const auto finish_iteration = [&](State &state, const unsigned int i) {
       // If alpha got very small, it is likely due to a bad Jacobian
       // approximation with Broyden's method (relatively far away from the
       // zero), which can be corrected by the outer loop when a Newton update
@@ -509,16 +599,20 @@ namespace ryujin
       // and cannot further improve the approximation or the Jacobian is
       // actually bad and we should fail as early as possible. Since we cannot
       // really distinguish the two, we must continue here in any case.
-      if (alpha <= 1e-4) {
+      if (state.alpha <= 1e-4) {
         // If we just recomputed the Jacobian by finite differences, we must
         // stop. If the reached tolerance was sufficiently small (less than
         // the square root of the tolerance), we return the best estimate,
         // else we return the invalid point.
-        if (must_recompute_jacobian == true) {
-          return residual_norm_square < std::sqrt(tolerance) ? chart_point
-                                                             : outside;
+        if (state.must_recompute_jacobian == true) {
+          finish(state,
+                 i,
+                 state.residual_norm_square < std::sqrt(tolerance)
+                     ? state.chart_point
+                     : outside);
+          return;
         } else
-          must_recompute_jacobian = true;
+          state.must_recompute_jacobian = true;
       }
 
       // update the inverse Jacobian with "Broyden's good method" and
@@ -530,32 +624,156 @@ namespace ryujin
       // switch sign in residual as compared to the formula above because we
       // use a negative definition of the residual with respect to the
       // Jacobian
-      const Tensor<1, spacedim> delta_f = old_residual - residual;
+      const Tensor<1, spacedim> delta_f = state.old_residual - state.residual;
 
       Tensor<1, dim> Jinv_deltaf;
       for (unsigned int d = 0; d < spacedim; ++d)
         for (unsigned int e = 0; e < dim; ++e)
-          Jinv_deltaf[e] += inv_grad[d][e] * delta_f[d];
+          Jinv_deltaf[e] += state.inv_grad[d][e] * delta_f[d];
 
-      const Tensor<1, dim> delta_x = alpha * update;
+      const Tensor<1, dim> delta_x = state.alpha * state.update;
 
       // prevent division by zero. This number should be scale-invariant
       // because Jinv_deltaf carries no units and x is in reference
       // coordinates.
       if (std::abs(delta_x * Jinv_deltaf) > 0.1 * tolerance &&
-          !must_recompute_jacobian) {
+          !state.must_recompute_jacobian) {
         const Tensor<1, dim> factor =
             (delta_x - Jinv_deltaf) / (delta_x * Jinv_deltaf);
         Tensor<1, spacedim> jac_update;
         for (unsigned int d = 0; d < spacedim; ++d)
           for (unsigned int e = 0; e < dim; ++e)
-            jac_update[d] += delta_x[e] * inv_grad[d][e];
+            jac_update[d] += delta_x[e] * state.inv_grad[d][e];
         for (unsigned int d = 0; d < spacedim; ++d)
           for (unsigned int e = 0; e < dim; ++e)
-            inv_grad[d][e] += factor[e] * jac_update[d];
+            state.inv_grad[d][e] += factor[e] * jac_update[d];
+      }
+
+      ++state.iteration;
+      state.stage = Stage::iterate;
+    };
+
+    // Run the control logic of a point until it requests a function
+    // evaluation or terminates:
+    const auto advance = [&](State &state, const unsigned int i) {
+      while (true) {
+        if (state.stage == Stage::iterate) {
+          if (state.iteration == 100) {
+            finish(state, i, outside);
+            return;
+          }
+
+          if (state.residual_norm_square < tolerance) {
+            // do a final update of the point with the last available
+            // Jacobian information. The residual is close to zero due to
+            // the check above, but me might improve some of the last
+            // digits by a final Newton-like step with step length 1
+            finish(state, i, state.chart_point + compute_update(state));
+            return;
+          }
+
+          // every 7 iterations, including the first time around, we
+          // create an approximation of the Jacobian with finite
+          // differences. Broyden's method usually does not need more than
+          // 5-8 iterations, but sometimes we might have had a bad initial
+          // guess and then we can accelerate convergence considerably
+          // with getting the actual Jacobian rather than using
+          // secant-like methods.
+          if (state.must_recompute_jacobian ||
+              (state.residual_norm_square > 1e4 * tolerance &&
+               state.iteration % 7 == 0)) {
+            state.stage = Stage::jacobian;
+            return;
+          }
+
+          start_line_search(state);
+        }
+
+        if (state.stage == Stage::line_search && state.alpha <= 1e-4) {
+          finish_iteration(state, i);
+          continue;
+        }
+
+        return;
+      }
+    };
+
+    const auto finite_difference_step = [](const Point<dim> &chart_point,
+                                           const unsigned int d) {
+      return chart_point[d] > 0.5 ? -1e-8 : 1e-8;
+    };
+
+    while (true) {
+      requests.clear();
+
+      for (unsigned int i = 0; i < n_points; ++i) {
+        auto &state = states[i];
+        advance(state, i);
+
+        if (state.stage == Stage::jacobian) {
+          for (unsigned int d = 0; d < dim; ++d) {
+            // avoid checking outside of the unit interval
+            Point<dim> modified = state.chart_point;
+            modified[d] += finite_difference_step(state.chart_point, d);
+            requests.push_back(modified);
+          }
+        } else if (state.stage == Stage::line_search) {
+          requests.push_back(state.chart_point + state.alpha * state.update);
+        }
+      }
+
+      if (requests.empty())
+        break;
+
+      evaluate_requests();
+
+      unsigned int k = 0;
+      for (unsigned int i = 0; i < n_points; ++i) {
+        auto &state = states[i];
+
+        if (state.stage == Stage::jacobian) {
+          // compute the derivative with the help of finite differences
+          const Point<spacedim> pushed_forward_chart_point =
+              points[i] - state.residual;
+          DerivativeForm<1, dim, spacedim> grad;
+          for (unsigned int d = 0; d < dim; ++d) {
+            const double step = finite_difference_step(state.chart_point, d);
+            const Tensor<1, spacedim> difference =
+                results[k++] - pushed_forward_chart_point;
+            for (unsigned int e = 0; e < spacedim; ++e)
+              grad[e][d] = difference[e] / step;
+          }
+
+          // if the determinant is zero or negative, the mapping is either
+          // not invertible or already has inverted and we are outside the
+          // valid chart region. Note that the Jacobian here represents the
+          // derivative of the forward map and should have a positive
+          // determinant since we use properly oriented meshes.
+          if (grad.determinant() <= 0.0) {
+            finish(state, i, outside);
+            continue;
+          }
+          state.inv_grad = grad.covariant_form();
+          state.must_recompute_jacobian = false;
+
+          start_line_search(state);
+
+        } else if (state.stage == Stage::line_search) {
+          const Tensor<1, spacedim> residual_guess = points[i] - results[k++];
+          const double residual_norm_new = residual_guess.norm_square();
+          if (residual_norm_new < state.residual_norm_square) {
+            state.residual_norm_square = residual_norm_new;
+            state.chart_point += state.alpha * state.update;
+            state.residual = residual_guess;
+            finish_iteration(state, i);
+          } else {
+            state.alpha *= 0.5;
+            if (state.alpha <= 1e-4)
+              finish_iteration(state, i);
+          }
+        }
       }
     }
-    return outside;
   }
 
 
@@ -585,11 +803,7 @@ namespace ryujin
       if (cell->material_id() == 42)
         continue;
 
-      std::array<Point<spacedim>, GeometryInfo<dim>::vertices_per_cell>
-          vertices;
-      for (const unsigned int vertex_n : GeometryInfo<dim>::vertex_indices()) {
-        vertices[vertex_n] = cell->vertex(vertex_n);
-      }
+      const auto &vertices = coarse_cell_data[cell->index()].vertices;
 
       // cheap check: if any of the points is not inside a circle around the
       // center of the loop, we can skip the expensive part below (this assumes
@@ -764,89 +978,157 @@ namespace ryujin
            ExcInternalError());
 
 
-    auto compute_chart_point =
+    // The guesses above depend on previously computed chart points. We
+    // therefore pull back the points in three phases, where all points of
+    // a phase are iterated simultaneously: (0) all points that start from
+    // the affine approximation, (1) the fourth vertex of a quadrilateral,
+    // (2) all remaining points whose guesses are derived from the chart
+    // points of phases 0 and 1.
+    const auto phase = [&](const unsigned int point_index) -> unsigned int {
+      if (point_index == 3 && surrounding_points.size() >= 8)
+        return 1;
+      else if ((use_structdim_2_guesses && 3 < point_index) ||
+               (use_structdim_3_guesses && 4 < point_index) ||
+               (dim == 3 && point_index > 7 &&
+                surrounding_points.size() == 26))
+        return 2;
+      return 0;
+    };
+
+    auto compute_guess =
         [&](const typename Triangulation<dim, spacedim>::cell_iterator &cell,
-            const unsigned int point_index) {
-          Point<dim> guess;
-          // an optimization: keep track of whether or not we used the affine
-          // approximation so that we don't call pull_back with the same
-          // initial guess twice (i.e., if pull_back fails the first time,
-          // don't try again with the same function arguments).
-          bool used_affine_approximation = false;
-          // if we have already computed three points, we can guess the fourth
-          // to be the missing corner point of a rectangle
-          if (point_index == 3 && surrounding_points.size() >= 8)
-            guess = chart_points[1] + (chart_points[2] - chart_points[0]);
-          else if (use_structdim_2_guesses && 3 < point_index)
-            guess = guess_chart_point_structdim_2(point_index);
-          else if (use_structdim_3_guesses && 4 < point_index)
-            guess = guess_chart_point_structdim_3(point_index);
-          else if (dim == 3 && point_index > 7 &&
-                   surrounding_points.size() == 26) {
-            if (point_index < 20)
-              guess =
-                  0.5 * (chart_points[GeometryInfo<dim>::line_to_cell_vertices(
-                             point_index - 8, 0)] +
-                         chart_points[GeometryInfo<dim>::line_to_cell_vertices(
-                             point_index - 8, 1)]);
-            else
-              guess =
-                  0.25 * (chart_points[GeometryInfo<dim>::face_to_cell_vertices(
-                              point_index - 20, 0)] +
-                          chart_points[GeometryInfo<dim>::face_to_cell_vertices(
-                              point_index - 20, 1)] +
-                          chart_points[GeometryInfo<dim>::face_to_cell_vertices(
-                              point_index - 20, 2)] +
-                          chart_points[GeometryInfo<dim>::face_to_cell_vertices(
-                              point_index - 20, 3)]);
-          } else {
-            guess = cell->real_to_unit_cell_affine_approximation(
-                surrounding_points[point_index]);
-            used_affine_approximation = true;
+            const unsigned int point_index) -> Point<dim> {
+      // if we have already computed three points, we can guess the fourth
+      // to be the missing corner point of a rectangle
+      if (point_index == 3 && surrounding_points.size() >= 8)
+        return chart_points[1] + (chart_points[2] - chart_points[0]);
+      else if (use_structdim_2_guesses && 3 < point_index)
+        return guess_chart_point_structdim_2(point_index);
+      else if (use_structdim_3_guesses && 4 < point_index)
+        return guess_chart_point_structdim_3(point_index);
+      else if (dim == 3 && point_index > 7 &&
+               surrounding_points.size() == 26) {
+        if (point_index < 20)
+          return 0.5 *
+                 (chart_points[GeometryInfo<dim>::line_to_cell_vertices(
+                      point_index - 8, 0)] +
+                  chart_points[GeometryInfo<dim>::line_to_cell_vertices(
+                      point_index - 8, 1)]);
+        else
+          return 0.25 *
+                 (chart_points[GeometryInfo<dim>::face_to_cell_vertices(
+                      point_index - 20, 0)] +
+                  chart_points[GeometryInfo<dim>::face_to_cell_vertices(
+                      point_index - 20, 1)] +
+                  chart_points[GeometryInfo<dim>::face_to_cell_vertices(
+                      point_index - 20, 2)] +
+                  chart_points[GeometryInfo<dim>::face_to_cell_vertices(
+                      point_index - 20, 3)]);
+      }
+      return cell->real_to_unit_cell_affine_approximation(
+          surrounding_points[point_index]);
+    };
+
+    boost::container::small_vector<unsigned int, 26> indices;
+    boost::container::small_vector<Point<spacedim>, 26> points;
+    boost::container::small_vector<Point<dim>, 26> guesses;
+    boost::container::small_vector<Point<dim>, 26> results;
+
+    // pull back all points in indices starting from guesses
+    const auto pull_back_indices =
+        [&](const typename Triangulation<dim, spacedim>::cell_iterator &cell) {
+          points.clear();
+          for (const auto i : indices)
+            points.push_back(surrounding_points[i]);
+          results.resize(indices.size());
+          pull_back(cell,
+                    make_array_view(points.begin(), points.end()),
+                    make_array_view(guesses.begin(), guesses.end()),
+                    make_array_view(results.begin(), results.end()));
+          for (unsigned int k = 0; k < indices.size(); ++k)
+            chart_points[indices[k]] = results[k];
+        };
+
+    // compute all chart points with respect to the given cell. If
+    // stop_early is set we return as soon as a chart point is found to be
+    // outside the unit cell.
+    const auto compute_chart_points_on_cell =
+        [&](const typename Triangulation<dim, spacedim>::cell_iterator &cell,
+            const bool stop_early) -> bool {
+      bool inside_unit_cell = true;
+
+      for (unsigned int p = 0; p < 3; ++p) {
+        // an optimization: keep track of whether or not we used the affine
+        // approximation so that we don't call pull_back with the same
+        // initial guess twice (i.e., if pull_back fails the first time,
+        // don't try again with the same function arguments).
+        boost::container::small_vector<unsigned int, 26> phase_indices;
+        boost::container::small_vector<bool, 26> used_affine_approximation;
+
+        indices.clear();
+        guesses.clear();
+        for (unsigned int i = 0; i < surrounding_points.size(); ++i)
+          if (phase(i) == p) {
+            indices.push_back(i);
+            guesses.push_back(compute_guess(cell, i));
+            used_affine_approximation.push_back(p == 0);
           }
-          chart_points[point_index] =
-              pull_back(cell, surrounding_points[point_index], guess);
-
-          // the initial guess may not have been good enough: if applicable,
-          // try again with the affine approximation (which is more accurate
-          // than the cheap methods used above)
-          if (chart_points[point_index][0] ==
-                  internal::invalid_pull_back_coordinate &&
-              !used_affine_approximation) {
-            guess = cell->real_to_unit_cell_affine_approximation(
-                surrounding_points[point_index]);
-            chart_points[point_index] =
-                pull_back(cell, surrounding_points[point_index], guess);
+        if (indices.empty())
+          continue;
+        phase_indices = indices;
+
+        pull_back_indices(cell);
+
+        // the initial guess may not have been good enough: if applicable,
+        // try again with the affine approximation (which is more accurate
+        // than the cheap methods used above)
+        indices.clear();
+        guesses.clear();
+        for (unsigned int k = 0; k < phase_indices.size(); ++k) {
+          const auto i = phase_indices[k];
+          if (chart_points[i][0] == internal::invalid_pull_back_coordinate &&
+              !used_affine_approximation[k]) {
+            indices.push_back(i);
+            guesses.push_back(cell->real_to_unit_cell_affine_approximation(
+                surrounding_points[i]));
           }
-
-          if (chart_points[point_index][0] ==
-              internal::invalid_pull_back_coordinate) {
+        }
+        if (!indices.empty())
+          pull_back_indices(cell);
+
+        indices.clear();
+        guesses.clear();
+        for (const auto i : phase_indices)
+          if (chart_points[i][0] == internal::invalid_pull_back_coordinate) {
+            Point<dim> guess;
             for (unsigned int d = 0; d < dim; ++d)
               guess[d] = 0.5;
-            chart_points[point_index] =
-                pull_back(cell, surrounding_points[point_index], guess);
+            indices.push_back(i);
+            guesses.push_back(guess);
           }
-        };
+        if (!indices.empty())
+          pull_back_indices(cell);
+
+        // Tolerance 5e-4 chosen that the method also works with manifolds
+        // that have some discretization error like SphericalManifold
+        for (const auto i : phase_indices)
+          if (GeometryInfo<dim>::is_inside_unit_cell(chart_points[i], 5e-4) ==
+              false)
+            inside_unit_cell = false;
+
+        if (!inside_unit_cell && stop_early)
+          return false;
+      }
+
+      return inside_unit_cell;
+    };
 
     // check whether all points are inside the unit cell of the current chart
     for (unsigned int c = 0; c < nearby_cells.size(); ++c) {
       typename Triangulation<dim, spacedim>::cell_iterator cell(
           &triangulation, level_coarse, nearby_cells[c]);
-      bool inside_unit_cell = true;
-      for (unsigned int i = 0; i < surrounding_points.size(); ++i) {
-        compute_chart_point(cell, i);
-
-        // Tolerance 5e-4 chosen that the method also works with manifolds
-        // that have some discretization error like SphericalManifold
-        if (GeometryInfo<dim>::is_inside_unit_cell(chart_points[i], 5e-4) ==
-            false) {
-          inside_unit_cell = false;
-          break;
-        }
-      }
-      if (inside_unit_cell == true) {
+      if (compute_chart_points_on_cell(cell, /*stop_early*/ true))
         return cell;
-      }
 
       // if we did not find a point and this was the last valid cell (the next
       // iterate being the end of the array or an invalid tag), we must stop
@@ -865,11 +1147,10 @@ namespace ryujin
                     << "    ";
           message << std::endl;
           message << "Transformation to chart coordinates: " << std::endl;
-          for (unsigned int i = 0; i < surrounding_points.size(); ++i) {
-            compute_chart_point(cell, i);
+          compute_chart_points_on_cell(cell, /*stop_early*/ false);
+          for (unsigned int i = 0; i < surrounding_points.size(); ++i)
             message << std::setprecision(16) << surrounding_points[i] << " -> "
                     << chart_points[i] << std::endl;
-          }
         }
 
         AssertThrow(false,
@@ -877,7 +1158,6 @@ namespace ryujin
                         message.str())));
       }
     }
-
     // a valid inversion should have returned a point above. an invalid
     // inversion should have triggered the assertion, so we should never end up
     // here
@@ -929,8 +1209,18 @@ namespace ryujin
                                    make_array_view(new_points_on_chart.begin(),
                                                    new_points_on_chart.end()));
 
-    for (unsigned int row = 0; row < weights.size(0); ++row)
-      new_points[row] = push_forward(cell, new_points_on_chart[row]);
+    // check that the points are in the unit cell which is the current
+    // chart, see push_forward()
+    for (const auto &chart_point : new_points_on_chart) {
+      (void)chart_point;
+      Assert(GeometryInfo<dim>::is_inside_unit_cell(chart_point, 5e-4),
+             ExcMessage("chart_point is not in unit interval"));
+    }
+
+    push_forward(cell,
+                 make_array_view(new_points_on_chart.begin(),
+                                 new_points_on_chart.end()),
+                 new_points);
   }
 
 } // namespace ryujin
@@ -94,6 +94,13 @@ namespace ryujin
      */
     void prepare();
 
+    /**
+     * Record the memory consumption (in bytes) of the output buffers in
+     * @p statistics.
+     */
+    void
+    memory_statistics(std::map<std::string, std::size_t> &statistics) const;
+
     /**
      * Given a state vector @p U and a file name prefix @p name, the
      * current time @p t, and the current output cycle @p cycle) schedule a
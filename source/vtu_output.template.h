@@ -309,4 +309,13 @@ namespace ryujin
     data_out.reset();
   }
 
+
+  template <typename Description, int dim, typename Number>
+  void VTUOutput<Description, dim, Number>::memory_statistics(
+      std::map<std::string, std::size_t> &statistics) const
+  {
+    statistics["VTUOutput - output buffers"] =
+        dealii::MemoryConsumption::memory_consumption(quantities_);
+  }
+
 } /* namespace ryujin */
@@ -0,0 +1,161 @@
+//
+// SPDX-License-Identifier: MIT
+// Copyright (C) 2020 - 2023 by the ryujin authors
+//
+
+#pragma once
+
+#include "patterns_conversion.h"
+
+#include <deal.II/base/mpi.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <string>
+
+#include <unistd.h>
+
+namespace ryujin
+{
+  /**
+   * Controls whether large arrays (sparse matrices and state vectors)
+   * are written with regular (cached) or with non-temporal (streaming)
+   * store instructions.
+   *
+   * A streaming store bypasses the cache hierarchy and avoids the
+   * read-for-ownership of the target cache line. This saves memory
+   * bandwidth if the written data is not read again before it would have
+   * been evicted from the last level cache anyway. On the other hand,
+   * streaming stores are detrimental if the data is read again shortly
+   * after, because the subsequent read then has to go to main memory.
+   *
+   * @ingroup SIMD
+   */
+  enum class WritePolicy {
+    /**
+     * Decide per array: use streaming stores if the estimated reuse
+     * distance of the written data exceeds the share of last level cache
+     * available to the MPI rank.
+     */
+    automatic,
+
+    /**
+     * Always use regular stores.
+     */
+    cached,
+
+    /**
+     * Always use streaming stores.
+     */
+    streaming,
+  };
+
+
+  /**
+   * Return the size of the last level cache of the host in bytes, or 0
+   * if the size could not be determined.
+   *
+   * @ingroup SIMD
+   */
+  inline std::size_t last_level_cache_size()
+  {
+    long size = 0;
+
+#ifdef _SC_LEVEL3_CACHE_SIZE
+    size = sysconf(_SC_LEVEL3_CACHE_SIZE);
+#endif
+#ifdef _SC_LEVEL2_CACHE_SIZE
+    if (size <= 0)
+      size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+#endif
+
+    /* Fall back to sysfs: */
+    for (unsigned int index : {3u, 2u}) {
+      if (size > 0)
+        break;
+      std::ifstream file("/sys/devices/system/cpu/cpu0/cache/index" +
+                         std::to_string(index) + "/size");
+      std::string entry;
+      if (file >> entry && !entry.empty()) {
+        std::size_t pos = 0;
+        size = std::stol(entry, &pos);
+        if (pos < entry.size() && (entry[pos] == 'K' || entry[pos] == 'k'))
+          size *= 1024;
+        else if (pos < entry.size() && entry[pos] == 'M')
+          size *= 1024 * 1024;
+      }
+    }
+
+    return size > 0 ? static_cast<std::size_t>(size) : 0;
+  }
+
+
+  /**
+   * Return the amount of last level cache (in bytes) available to the
+   * current MPI rank, i.e., the cache size @p cache_size divided by the
+   * number of MPI ranks sharing the same node. If @p cache_size is 0 the
+   * size is determined with last_level_cache_size().
+   *
+   * @note This is a conservative estimate for nodes with more than one
+   * socket.
+   *
+   * @ingroup SIMD
+   */
+  inline std::size_t cache_capacity_per_rank(const MPI_Comm &mpi_communicator,
+                                             std::size_t cache_size = 0)
+  {
+    if (cache_size == 0)
+      cache_size = last_level_cache_size();
+
+    int n_ranks_on_node = 1;
+#ifdef DEAL_II_WITH_MPI
+    MPI_Comm node_communicator;
+    MPI_Comm_split_type(mpi_communicator,
+                        MPI_COMM_TYPE_SHARED,
+                        0,
+                        MPI_INFO_NULL,
+                        &node_communicator);
+    MPI_Comm_size(node_communicator, &n_ranks_on_node);
+    MPI_Comm_free(&node_communicator);
+#else
+    (void)mpi_communicator;
+#endif
+
+    return cache_size / std::max(n_ranks_on_node, 1);
+  }
+
+
+  /**
+   * Decide whether an array should be written with streaming stores.
+   * The parameter @p reuse_distance is the (estimated) number of bytes
+   * accessed by the current MPI rank between writing an entry of the
+   * array and reading it again. The parameter @p cache_capacity is the
+   * share of the last level cache available to the rank, see
+   * cache_capacity_per_rank(). A cache capacity of 0 (unknown cache
+   * size) results in regular stores for WritePolicy::automatic.
+   *
+   * @ingroup SIMD
+   */
+  inline bool use_streaming_store(const WritePolicy policy,
+                                  const std::size_t reuse_distance,
+                                  const std::size_t cache_capacity)
+  {
+    switch (policy) {
+    case WritePolicy::cached:
+      return false;
+    case WritePolicy::streaming:
+      return true;
+    case WritePolicy::automatic:
+      break;
+    }
+    return cache_capacity != 0 && reuse_distance > cache_capacity;
+  }
+} // namespace ryujin
+
+#ifndef DOXYGEN
+DECLARE_ENUM(ryujin::WritePolicy,
+             LIST({ryujin::WritePolicy::automatic, "automatic"},
+                  {ryujin::WritePolicy::cached, "cached"},
+                  {ryujin::WritePolicy::streaming, "streaming"}, ));
+#endif
@@ -0,0 +1,307 @@
+#include <compile_time_options.h>
+#include <discretization.h>
+#include <offline_data.h>
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/dofs/dof_tools.h>
+#include <deal.II/fe/fe_values.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <tuple>
+
+using namespace ryujin;
+using namespace dealii;
+
+/*
+ * Compare the boundary maps constructed by OfflineData (on the active
+ * level and on all multigrid levels) bit for bit against a reference
+ * implementation that performs a serial loop over all cells and
+ * evaluates face values for every boundary face.
+ *
+ * For a rectangular domain with a different boundary condition on every
+ * side (in 2D) we also print the size and the contents of the boundary
+ * map sorted by position and boundary id.
+ *
+ * As a simple benchmark, we also report the runtime of the reference
+ * implementation and of OfflineData::prepare() on std::cerr (not part of
+ * the test output).
+ */
+
+constexpr int dim = DIM;
+using Number = NUMBER;
+
+using boundary_map_type =
+    std::decay_t<decltype(std::declval<OfflineData<dim, Number>>()
+                              .boundary_map())>;
+
+
+template <typename ITERATOR1, typename ITERATOR2>
+boundary_map_type
+reference_boundary_map(const OfflineData<dim, Number> &offline_data,
+                       const ITERATOR1 &begin,
+                       const ITERATOR2 &end,
+                       const Utilities::MPI::Partitioner &partitioner,
+                       const AffineConstraints<float> *level_constraints)
+{
+  const auto &discretization = offline_data.discretization();
+  const auto &finite_element = begin->get_dof_handler().get_fe();
+
+  boundary_map_type preliminary_map;
+
+  std::vector<types::global_dof_index> local_dof_indices;
+
+  const QGauss<dim - 1> face_quadrature(3);
+  FEFaceValues<dim> fe_face_values(discretization.mapping(),
+                                   finite_element,
+                                   face_quadrature,
+                                   update_normal_vectors | update_values |
+                                       update_JxW_values);
+
+  const unsigned int dofs_per_cell = finite_element.dofs_per_cell;
+  const auto support_points = finite_element.get_unit_support_points();
+
+  for (auto cell = begin; cell != end; ++cell) {
+    if (!cell->is_locally_owned_on_level())
+      continue;
+
+    local_dof_indices.resize(dofs_per_cell);
+    cell->get_active_or_mg_dof_indices(local_dof_indices);
+
+    for (auto f : GeometryInfo<dim>::face_indices()) {
+      const auto face = cell->face(f);
+      const auto id = face->boundary_id();
+
+      if (!face->at_boundary() || id == Boundary::periodic)
+        continue;
+
+      fe_face_values.reinit(cell, f);
+
+      for (unsigned int j = 0; j < dofs_per_cell; ++j) {
+        if (!finite_element.has_support_on_face(j, f))
+          continue;
+
+        Number boundary_mass = 0.;
+        Tensor<1, dim, Number> normal;
+
+        for (unsigned int q = 0; q < face_quadrature.size(); ++q) {
+          const auto JxW = fe_face_values.JxW(q);
+          const auto phi_i = fe_face_values.shape_value(j, q);
+
+          boundary_mass += phi_i * JxW;
+          normal += phi_i * fe_face_values.normal_vector(q) * JxW;
+        }
+
+        const auto global_index = local_dof_indices[j];
+        const auto index = partitioner.global_to_local(global_index);
+
+        if (index >= partitioner.locally_owned_size())
+          continue;
+
+        if (level_constraints != nullptr) {
+          if (level_constraints->is_constrained(global_index))
+            continue;
+        } else {
+          if (offline_data.sparsity_pattern_simd().row_length(index) == 1)
+            continue;
+        }
+
+        const Point<dim> position =
+            discretization.mapping().transform_unit_to_real_cell(
+                cell, support_points[j]);
+
+        preliminary_map.insert(
+            {index, {normal, boundary_mass, boundary_mass, id, position}});
+      }
+    }
+  }
+
+  boundary_map_type filtered_map;
+  for (auto entry : preliminary_map) {
+    bool inserted = false;
+    const auto range = filtered_map.equal_range(entry.first);
+    for (auto it = range.first; it != range.second; ++it) {
+      const auto &[new_normal,
+                   new_normal_mass,
+                   new_boundary_mass,
+                   new_id,
+                   new_point] = entry.second;
+      auto &[normal, normal_mass, boundary_mass, id, point] = it->second;
+
+      if (id != new_id)
+        continue;
+
+      if (normal * new_normal / normal.norm() / new_normal.norm() > 0.08) {
+        normal += new_normal;
+        boundary_mass += new_boundary_mass;
+        inserted = true;
+      }
+    }
+    if (!inserted)
+      filtered_map.insert(entry);
+  }
+
+  for (auto &it : filtered_map) {
+    auto &[normal, normal_mass, boundary_mass, id, point] = it.second;
+    const auto new_normal_mass =
+        normal.norm() + std::numeric_limits<Number>::epsilon();
+    normal_mass = new_normal_mass;
+    normal /= new_normal_mass;
+  }
+
+  return filtered_map;
+}
+
+
+bool agree(const boundary_map_type &map, const boundary_map_type &reference)
+{
+  return std::equal(map.begin(), map.end(), reference.begin(), reference.end());
+}
+
+
+/*
+ * Print the boundary map sorted by position and boundary id. The dof
+ * indices depend on the renumbering and are not printed.
+ */
+void print(const boundary_map_type &map)
+{
+  /* Round to the printed precision and avoid printing "-0.0000": */
+  const auto round = [](const double value) {
+    const double result = std::round(value * 1.e4) * 1.e-4;
+    return result == 0. ? 0. : result;
+  };
+
+  using entry_type =
+      std::tuple<Point<dim>, types::boundary_id, Tensor<1, dim>, double>;
+  std::vector<entry_type> entries;
+  for (const auto &[i, entry] : map) {
+    const auto &[normal, normal_mass, boundary_mass, id, position] = entry;
+    entries.emplace_back(position, id, normal, boundary_mass);
+  }
+
+  std::sort(entries.begin(), entries.end(), [](const auto &a, const auto &b) {
+    const auto &[p_a, id_a, n_a, m_a] = a;
+    const auto &[p_b, id_b, n_b, m_b] = b;
+    for (unsigned int d = 0; d < dim; ++d)
+      if (p_a[d] != p_b[d])
+        return p_a[d] < p_b[d];
+    return id_a < id_b;
+  });
+
+  std::cout << "boundary map size: " << map.size() << std::endl;
+  std::cout << std::fixed << std::setprecision(4);
+  for (const auto &[position, id, normal, boundary_mass] : entries) {
+    std::cout << "position (" << round(position[0]);
+    for (unsigned int d = 1; d < dim; ++d)
+      std::cout << ", " << round(position[d]);
+    std::cout << "), id " << static_cast<unsigned int>(id) << ", normal ("
+              << round(normal[0]);
+    for (unsigned int d = 1; d < dim; ++d)
+      std::cout << ", " << round(normal[d]);
+    std::cout << "), boundary mass " << round(boundary_mass) << std::endl;
+  }
+  std::cout << std::defaultfloat;
+}
+
+
+int main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  const MPI_Comm mpi_communicator = MPI_COMM_WORLD;
+
+  Discretization<dim> discretization(mpi_communicator, "/Discretization");
+  OfflineData<dim, Number> offline_data(mpi_communicator, discretization);
+
+  std::vector<std::tuple<std::string, unsigned int, std::string>> geometries{
+      {"cylinder", 3, ""}};
+  if constexpr (dim == 2) {
+    geometries.push_back({"airfoil", 1, ""});
+    geometries.push_back({"rectangular domain",
+                          2,
+                          "subsection rectangular domain\n"
+                          "set boundary condition bottom = slip\n"
+                          "set boundary condition left   = dirichlet\n"
+                          "set boundary condition right  = dynamic\n"
+                          "set boundary condition top    = no_slip\n"
+                          "set position bottom left      = 0, 0\n"
+                          "set position top right        = 1, 1\n"
+                          "end\n"});
+  }
+
+  bool maps_agree = true;
+  bool level_maps_agree = true;
+  bool maps_nonempty = true;
+
+  for (const auto &[geometry, refinement, extra_parameters] : geometries) {
+    std::stringstream parameters;
+    parameters << "subsection Discretization\n"
+               << "set geometry = " << geometry << "\n"
+               << "set mesh refinement = " << refinement << "\n"
+               << extra_parameters << "end" << std::endl;
+    ParameterAcceptor::initialize(parameters);
+
+    discretization.prepare();
+
+    auto start = std::chrono::steady_clock::now();
+    offline_data.prepare(dim + 2);
+    const std::chrono::duration<double> time_prepare =
+        std::chrono::steady_clock::now() - start;
+
+    const auto &dof_handler = offline_data.dof_handler();
+
+    start = std::chrono::steady_clock::now();
+    const auto reference =
+        reference_boundary_map(offline_data,
+                               dof_handler.begin_active(),
+                               dof_handler.end(),
+                               *offline_data.scalar_partitioner(),
+                               nullptr);
+    const std::chrono::duration<double> time_reference =
+        std::chrono::steady_clock::now() - start;
+
+    std::cerr << geometry << ": OfflineData::prepare() "
+              << time_prepare.count() << "s, reference boundary map "
+              << time_reference.count() << "s" << std::endl;
+
+    if (reference.empty())
+      maps_nonempty = false;
+    if (!agree(offline_data.boundary_map(), reference))
+      maps_agree = false;
+
+    if (geometry == "rectangular domain")
+      print(offline_data.boundary_map());
+
+    const auto &level_dof_handler = offline_data.level_dof_handler();
+    const auto &level_boundary_map = offline_data.level_boundary_map();
+    for (unsigned int level = 0; level < level_boundary_map.size(); ++level) {
+      IndexSet relevant;
+      DoFTools::extract_locally_relevant_level_dofs(
+          level_dof_handler, level, relevant);
+      const Utilities::MPI::Partitioner partitioner(
+          level_dof_handler.locally_owned_mg_dofs(level),
+          relevant,
+          mpi_communicator);
+
+      const auto level_reference = reference_boundary_map(
+          offline_data,
+          level_dof_handler.begin_mg(level),
+          level_dof_handler.end_mg(level),
+          partitioner,
+          &offline_data.level_affine_constraints()[level]);
+
+      if (!agree(level_boundary_map[level], level_reference))
+        level_maps_agree = false;
+    }
+  }
+
+  std::cout << "boundary maps nonempty: " << (maps_nonempty ? "OK" : "FAILED")
+            << std::endl;
+  std::cout << "boundary maps agree with reference: "
+            << (maps_agree ? "OK" : "FAILED") << std::endl;
+  std::cout << "level boundary maps agree with reference: "
+            << (level_maps_agree ? "OK" : "FAILED") << std::endl;
+}
@@ -0,0 +1,187 @@
+#include <compile_time_options.h>
+#include <discretization.h>
+#include <offline_data.h>
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/dofs/dof_tools.h>
+#include <deal.II/fe/fe_values.h>
+
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+
+using namespace ryujin;
+using namespace dealii;
+
+/*
+ * Compare the multigrid level data created by OfflineData (level
+ * lumped mass matrices assembled with WorkStream, level boundary maps
+ * built concurrently, and the periodicity constraints of every level)
+ * against a serial reference on a mesh that is periodic in y-direction:
+ *
+ *  - Every level constraint has to identify a degree of freedom on the
+ *    top side with the degree of freedom on the bottom side at the same
+ *    x-position (a single entry with weight 1). For n cells per
+ *    direction there are n + 1 such pairs.
+ *
+ *  - The level lumped mass matrix has to agree with a serial loop over
+ *    all level cells that distributes the cell contributions through the
+ *    level constraints. The lumped masses sum up to the area of the
+ *    domain.
+ *
+ *  - The level boundary map must not contain constrained degrees of
+ *    freedom. With Dirichlet conditions on the left and right side it
+ *    contains the n + 1 degrees of freedom of each side, except for the
+ *    constrained top (or bottom) corner: 2 n entries.
+ */
+
+constexpr int dim = DIM;
+using Number = NUMBER;
+
+static const std::string parameters = R"(
+subsection Discretization
+  set geometry        = rectangular domain
+  set mesh refinement = 3
+  subsection rectangular domain
+    set boundary condition bottom = periodic
+    set boundary condition left   = dirichlet
+    set boundary condition right  = dirichlet
+    set boundary condition top    = periodic
+    set position bottom left      = 0, 0
+    set position top right        = 1, 1
+    set subdivisions x            = 2
+    set subdivisions y            = 2
+  end
+end
+)";
+
+
+int main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  const MPI_Comm mpi_communicator = MPI_COMM_WORLD;
+
+  static_assert(dim == 2, "The test is set up for two spatial dimensions");
+
+  Discretization<dim> discretization(mpi_communicator, "/Discretization");
+  OfflineData<dim, Number> offline_data(mpi_communicator, discretization);
+
+  std::stringstream input(parameters);
+  ParameterAcceptor::initialize(input);
+
+  discretization.prepare();
+  offline_data.prepare(dim + 2);
+
+  const auto &dof_handler = offline_data.level_dof_handler();
+  const auto &finite_element = dof_handler.get_fe();
+  const auto &mapping = discretization.mapping();
+  const auto unit_support_points = finite_element.get_unit_support_points();
+  const unsigned int dofs_per_cell = finite_element.dofs_per_cell;
+
+  const auto n_levels = dof_handler.get_triangulation().n_global_levels();
+
+  for (unsigned int level = 0; level < n_levels; ++level) {
+    const auto &constraints = offline_data.level_affine_constraints()[level];
+    const auto &lumped_mass_matrix =
+        offline_data.level_lumped_mass_matrix()[level];
+    const auto &boundary_map = offline_data.level_boundary_map()[level];
+
+    /* Serial reference: support points and lumped mass matrix: */
+
+    std::map<types::global_dof_index, Point<dim>> support_points;
+
+    LinearAlgebra::distributed::Vector<float> reference;
+    reference.reinit(lumped_mass_matrix);
+
+    FEValues<dim> fe_values(mapping,
+                            finite_element,
+                            discretization.quadrature(),
+                            update_values | update_JxW_values);
+    std::vector<types::global_dof_index> dof_indices(dofs_per_cell);
+    Vector<float> mass_values(dofs_per_cell);
+
+    for (const auto &cell : dof_handler.cell_iterators_on_level(level)) {
+      if (!cell->is_locally_owned_on_level())
+        continue;
+
+      cell->get_mg_dof_indices(dof_indices);
+      for (unsigned int j = 0; j < dofs_per_cell; ++j)
+        support_points[dof_indices[j]] =
+            mapping.transform_unit_to_real_cell(cell, unit_support_points[j]);
+
+      fe_values.reinit(cell);
+      for (unsigned int j = 0; j < dofs_per_cell; ++j) {
+        double sum = 0.;
+        for (unsigned int q = 0; q < fe_values.n_quadrature_points; ++q)
+          sum += fe_values.shape_value(j, q) * fe_values.JxW(q);
+        mass_values(j) = sum;
+      }
+      constraints.distribute_local_to_global(
+          mass_values, dof_indices, reference);
+    }
+    reference.compress(VectorOperation::add);
+
+    /* Periodicity constraints: */
+
+    unsigned int n_constraints = 0;
+    bool constraints_periodic = true;
+    for (const auto &line : constraints.get_lines()) {
+      ++n_constraints;
+      if (line.entries.size() != 1 || line.entries[0].second != 1.f ||
+          support_points.count(line.index) == 0 ||
+          support_points.count(line.entries[0].first) == 0) {
+        constraints_periodic = false;
+        continue;
+      }
+      const auto &p = support_points[line.index];
+      const auto &q = support_points[line.entries[0].first];
+      if (std::abs(p[0] - q[0]) > 1.e-12 ||
+          std::abs(std::abs(p[1] - q[1]) - 1.) > 1.e-12)
+        constraints_periodic = false;
+    }
+    n_constraints = Utilities::MPI::sum(n_constraints, mpi_communicator);
+
+    /* Lumped mass matrix: */
+
+    double total_mass = 0.;
+    bool masses_agree = true;
+    for (unsigned int i = 0; i < lumped_mass_matrix.locally_owned_size();
+         ++i) {
+      const auto m_i = lumped_mass_matrix.local_element(i);
+      const auto r_i = reference.local_element(i);
+      total_mass += m_i;
+      if (!(std::abs(m_i - r_i) <= 1.e-6 * std::abs(r_i)))
+        masses_agree = false;
+    }
+    total_mass = Utilities::MPI::sum(total_mass, mpi_communicator);
+    masses_agree =
+        Utilities::MPI::min(masses_agree ? 1 : 0, mpi_communicator) == 1;
+
+    /* Boundary map: */
+
+    const auto &partitioner = *lumped_mass_matrix.get_partitioner();
+    unsigned int n_boundary_entries = 0;
+    bool boundary_map_unconstrained = true;
+    for (const auto &[i, entry] : boundary_map) {
+      ++n_boundary_entries;
+      if (constraints.is_constrained(partitioner.local_to_global(i)))
+        boundary_map_unconstrained = false;
+    }
+    n_boundary_entries =
+        Utilities::MPI::sum(n_boundary_entries, mpi_communicator);
+
+    std::cout << "level " << level << ":" << std::endl;
+    std::cout << "  periodicity constraints: " << n_constraints
+              << ", identify top and bottom: "
+              << (constraints_periodic ? "OK" : "FAILED") << std::endl;
+    std::cout << "  lumped mass matrix total: " << std::fixed
+              << std::setprecision(6) << total_mass << std::defaultfloat
+              << ", agrees with serial assembly: "
+              << (masses_agree ? "OK" : "FAILED") << std::endl;
+    std::cout << "  boundary map size: " << n_boundary_entries
+              << ", unconstrained: "
+              << (boundary_map_unconstrained ? "OK" : "FAILED") << std::endl;
+  }
+}
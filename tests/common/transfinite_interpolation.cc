@@ -0,0 +1,247 @@
+#include <transfinite_interpolation.h>
+#include <transfinite_interpolation.template.h>
+
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/table.h>
+#include <deal.II/fe/fe_nothing.h>
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/manifold_lib.h>
+#include <deal.II/grid/tria.h>
+
+#include <iostream>
+#include <optional>
+
+using namespace dealii;
+
+/*
+ * Refine a square (2D) and a cube (3D) with a cylindrical hole, where
+ * the interior is described by a transfinite interpolation of the curved
+ * hole, and compare ryujin::TransfiniteInterpolationManifold (batched
+ * quasi-Newton pull back) point for point against the scalar pull back
+ * of dealii::TransfiniteInterpolationManifold:
+ *
+ *  - the vertices and the quadrature points of a high order mapping
+ *    after global refinement,
+ *
+ *  - the new points returned by get_new_point() and get_new_points() for
+ *    the vertices of every active cell of the refined mesh (a Q1
+ *    interpolation to the cell center and to the Gauss points),
+ *
+ *  - point sets without a valid chart: the vertices of every active cell
+ *    at the hole together with a point on the axis of the hole. The
+ *    quasi-Newton iteration cannot find chart coordinates for the latter
+ *    on any coarse cell, and both implementations have to report a
+ *    failed transformation.
+ *
+ * We print the number of compared points and the number of points that
+ * differ by more than 1e-10.
+ */
+
+template <int dim>
+std::vector<Point<dim>> quadrature_points(const Triangulation<dim> &tria)
+{
+  const MappingQ<dim> mapping(4);
+  const FE_Nothing<dim> fe;
+  FEValues<dim> fe_values(
+      mapping, fe, QGauss<dim>(3), update_quadrature_points);
+
+  std::vector<Point<dim>> points;
+  for (const auto &cell : tria.active_cell_iterators()) {
+    fe_values.reinit(cell);
+    for (const auto &point : fe_values.get_quadrature_points())
+      points.push_back(point);
+  }
+  return points;
+}
+
+
+template <int dim, typename MANIFOLD>
+std::pair<std::vector<Point<dim>>, std::vector<Point<dim>>>
+refine(const Triangulation<dim> &coarse_triangulation,
+       const Manifold<dim> &hole_manifold,
+       const unsigned int n_refinements)
+{
+  Triangulation<dim> tria;
+  tria.copy_triangulation(coarse_triangulation);
+  tria.set_manifold(0, hole_manifold);
+
+  MANIFOLD transfinite;
+  transfinite.initialize(tria);
+  tria.set_manifold(1, transfinite);
+
+  tria.refine_global(n_refinements);
+  auto points = quadrature_points(tria);
+
+  return {tria.get_vertices(), std::move(points)};
+}
+
+
+template <int dim>
+void print(const std::string &name,
+           const std::vector<Point<dim>> &points,
+           const std::vector<Point<dim>> &reference_points)
+{
+  AssertDimension(points.size(), reference_points.size());
+
+  unsigned int n_differing = 0;
+  for (unsigned int i = 0; i < points.size(); ++i)
+    if (!(points[i].distance(reference_points[i]) <= 1.e-10))
+      ++n_differing;
+
+  std::cout << "  " << name << ": " << points.size() << ", differing "
+            << n_differing << std::endl;
+}
+
+
+/*
+ * Return the new point for @p surrounding_points and @p weights, or an
+ * empty optional if the manifold cannot find a chart for them.
+ */
+template <int dim>
+std::optional<Point<dim>>
+new_point(const Manifold<dim> &manifold,
+          const std::vector<Point<dim>> &surrounding_points,
+          const std::vector<double> &weights)
+{
+  try {
+    return manifold.get_new_point(make_array_view(surrounding_points),
+                                  make_array_view(weights));
+  } catch (typename Mapping<dim>::ExcTransformationFailed &) {
+    return std::nullopt;
+  }
+}
+
+
+template <int dim>
+void test(const Manifold<dim> &hole_manifold, const unsigned int n_refinements)
+{
+  Triangulation<dim> coarse_triangulation;
+  GridGenerator::hyper_cube_with_cylindrical_hole(
+      coarse_triangulation, 0.25, 1.0);
+
+  /* Curved hole (manifold id 0), transfinite interpolation elsewhere: */
+  coarse_triangulation.set_all_manifold_ids(1);
+  for (const auto &cell : coarse_triangulation.active_cell_iterators())
+    for (const auto f : cell->face_indices()) {
+      const auto face = cell->face(f);
+      const auto center = face->center();
+      if (face->at_boundary() &&
+          center[0] * center[0] + center[1] * center[1] < 0.25)
+        face->set_all_manifold_ids(0);
+    }
+
+  std::cout << dim << "D:" << std::endl;
+
+  /* Global refinement: */
+
+  const auto [vertices, points] =
+      refine<dim, ryujin::TransfiniteInterpolationManifold<dim>>(
+          coarse_triangulation, hole_manifold, n_refinements);
+
+  const auto [reference_vertices, reference_points] =
+      refine<dim, dealii::TransfiniteInterpolationManifold<dim>>(
+          coarse_triangulation, hole_manifold, n_refinements);
+
+  print("vertices", vertices, reference_vertices);
+  print("mapping quadrature points", points, reference_points);
+
+  /* Both manifolds on the same refined mesh: */
+
+  Triangulation<dim> tria;
+  tria.copy_triangulation(coarse_triangulation);
+  tria.set_manifold(0, hole_manifold);
+
+  ryujin::TransfiniteInterpolationManifold<dim> manifold;
+  manifold.initialize(tria);
+
+  dealii::TransfiniteInterpolationManifold<dim> reference_manifold;
+  reference_manifold.initialize(tria);
+  tria.set_manifold(1, reference_manifold);
+  tria.refine_global(n_refinements);
+
+  const QGauss<dim> quadrature(2);
+  Table<2, double> weights(quadrature.size(),
+                           GeometryInfo<dim>::vertices_per_cell);
+  for (unsigned int q = 0; q < quadrature.size(); ++q)
+    for (const unsigned int v : GeometryInfo<dim>::vertex_indices())
+      weights(q, v) = GeometryInfo<dim>::d_linear_shape_function(
+          quadrature.point(q), v);
+
+  const std::vector<double> center_weights(
+      GeometryInfo<dim>::vertices_per_cell,
+      1. / GeometryInfo<dim>::vertices_per_cell);
+
+  std::vector<Point<dim>> centers, reference_centers;
+  std::vector<Point<dim>> gauss_points, reference_gauss_points;
+
+  unsigned int n_sets = 0;
+  unsigned int n_failures = 0;
+  unsigned int n_reference_failures = 0;
+
+  for (const auto &cell : tria.active_cell_iterators()) {
+    std::vector<Point<dim>> surrounding_points;
+    for (const unsigned int v : cell->vertex_indices())
+      surrounding_points.push_back(cell->vertex(v));
+
+    /* get_new_point(): */
+
+    const auto center = new_point(manifold, surrounding_points, center_weights);
+    const auto reference_center =
+        new_point(reference_manifold, surrounding_points, center_weights);
+    centers.push_back(center.value_or(Point<dim>()));
+    reference_centers.push_back(reference_center.value_or(Point<dim>()));
+    n_failures += !center.has_value();
+    n_reference_failures += !reference_center.has_value();
+
+    /* get_new_points(): */
+
+    const unsigned int offset = gauss_points.size();
+    gauss_points.resize(offset + quadrature.size());
+    reference_gauss_points.resize(offset + quadrature.size());
+    manifold.get_new_points(
+        make_array_view(surrounding_points),
+        weights,
+        make_array_view(gauss_points.begin() + offset, gauss_points.end()));
+    reference_manifold.get_new_points(
+        make_array_view(surrounding_points),
+        weights,
+        make_array_view(reference_gauss_points.begin() + offset,
+                        reference_gauss_points.end()));
+
+    /* A point on the axis of the hole has no valid chart: */
+
+    bool at_hole = false;
+    for (const auto f : cell->face_indices())
+      at_hole |= cell->face(f)->manifold_id() == 0;
+    if (!at_hole)
+      continue;
+
+    Point<dim> axis_point;
+    if constexpr (dim == 3)
+      axis_point[2] = cell->center()[2];
+    surrounding_points.push_back(axis_point);
+
+    const std::vector<double> equal_weights(surrounding_points.size(),
+                                            1. / surrounding_points.size());
+    ++n_sets;
+    n_failures += !new_point(manifold, surrounding_points, equal_weights);
+    n_reference_failures +=
+        !new_point(reference_manifold, surrounding_points, equal_weights);
+  }
+
+  print("get_new_point() cell centers", centers, reference_centers);
+  print("get_new_points() Gauss points", gauss_points, reference_gauss_points);
+
+  std::cout << "  point sets without a valid chart: " << n_sets
+            << ", failed transformations " << n_failures << ", reference "
+            << n_reference_failures << std::endl;
+}
+
+
+int main()
+{
+  test<2>(SphericalManifold<2>(), 4);
+  test<3>(CylindricalManifold<3>(2), 2);
+}
@@ -0,0 +1,137 @@
+#include <multicomponent_vector.h>
+#include <sparse_matrix_simd.h>
+#include <sparse_matrix_simd.template.h>
+#include <write_policy.h>
+
+#include <deal.II/base/mpi.h>
+
+#include <iostream>
+
+/*
+ * Check that the cached and streaming write paths of
+ * MultiComponentVector and SparseMatrixSIMD produce identical results
+ * and that the automatic write policy takes the expected decisions.
+ */
+
+int main(int argc, char *argv[])
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+
+  using namespace ryujin;
+
+  constexpr int simd_length = dealii::VectorizedArray<double>::size();
+  using VA = dealii::VectorizedArray<double, simd_length>;
+
+  std::cout << "Write policy decisions:" << std::endl;
+  for (const auto policy :
+       {WritePolicy::automatic, WritePolicy::cached, WritePolicy::streaming}) {
+    const auto name =
+        dealii::Patterns::Tools::Convert<WritePolicy>::to_string(policy);
+    std::cout << name << ": " << use_streaming_store(policy, 100, 1000) << " "
+              << use_streaming_store(policy, 1000, 100) << " "
+              << use_streaming_store(policy, 1000, 0) << std::endl;
+  }
+
+  /*
+   * MultiComponentVector:
+   */
+
+  constexpr unsigned int n_comp = 4;
+  constexpr unsigned int size = 1 << 12;
+
+  dealii::IndexSet locally_owned(size);
+  locally_owned.add_range(0, size);
+  const auto scalar_partitioner =
+      std::make_shared<dealii::Utilities::MPI::Partitioner>(
+          locally_owned, dealii::IndexSet(size), MPI_COMM_SELF);
+  const auto vector_partitioner =
+      create_vector_partitioner(scalar_partitioner, n_comp);
+
+  MultiComponentVector<double, n_comp> cached;
+  MultiComponentVector<double, n_comp> streaming;
+  cached.reinit(vector_partitioner);
+  streaming.reinit(vector_partitioner);
+
+  const auto fill_vector = [&](auto &vector, const bool do_streaming_store) {
+    for (unsigned int i = 0; i < size; i += simd_length) {
+      dealii::Tensor<1, n_comp, VA> tensor;
+      for (unsigned int d = 0; d < n_comp; ++d)
+        for (unsigned int k = 0; k < simd_length; ++k)
+          tensor[d][k] = 1. * (i + k) + 0.25 * d;
+      vector.template write_tensor<VA>(tensor, i, do_streaming_store);
+    }
+  };
+
+  fill_vector(cached, false);
+  fill_vector(streaming, true);
+
+  bool vectors_agree = true;
+  for (unsigned int i = 0; i < size; ++i)
+    if (cached.get_tensor(i) != streaming.get_tensor(i))
+      vectors_agree = false;
+  std::cout << "MultiComponentVector: " << (vectors_agree ? "OK" : "FAILED")
+            << std::endl;
+
+  /*
+   * SparseMatrixSIMD with a periodic tridiagonal sparsity pattern. All
+   * rows have the same length, so that every row (and every SIMD group of
+   * rows) can be part of the vectorized index range:
+   */
+
+  dealii::DynamicSparsityPattern sparsity(size, size);
+  for (unsigned int i = 0; i < size; ++i) {
+    sparsity.add(i, i);
+    sparsity.add(i, (i + size - 1) % size);
+    sparsity.add(i, (i + 1) % size);
+  }
+
+  const unsigned int n_internal = size;
+  SparsityPatternSIMD<simd_length> sparsity_simd(
+      n_internal, sparsity, scalar_partitioner);
+
+  SparseMatrixSIMD<double, n_comp> matrix_cached(sparsity_simd);
+  SparseMatrixSIMD<double, n_comp> matrix_streaming(sparsity_simd);
+
+  const auto fill_matrix = [&](auto &matrix, const bool do_streaming_store) {
+    for (unsigned int i = 0; i < n_internal; i += simd_length) {
+      const unsigned int row_length = sparsity_simd.row_length(i);
+      for (unsigned int col_idx = 0; col_idx < row_length; ++col_idx) {
+        dealii::Tensor<1, n_comp, VA> tensor;
+        for (unsigned int d = 0; d < n_comp; ++d)
+          tensor[d] = 1. * i + 0.5 * col_idx + 0.25 * d;
+        matrix.write_tensor(tensor, i, col_idx, do_streaming_store);
+      }
+    }
+  };
+
+  fill_matrix(matrix_cached, false);
+  fill_matrix(matrix_streaming, true);
+
+  bool matrices_agree = true;
+  for (unsigned int i = 0; i < n_internal; ++i)
+    for (unsigned int col_idx = 0; col_idx < sparsity_simd.row_length(i);
+         ++col_idx)
+      if (matrix_cached.get_tensor(i, col_idx) !=
+          matrix_streaming.get_tensor(i, col_idx))
+        matrices_agree = false;
+  std::cout << "SparseMatrixSIMD: " << (matrices_agree ? "OK" : "FAILED")
+            << std::endl;
+
+  /*
+   * Automatic decision for the matrix: An entry is read again only after
+   * the whole matrix has been written, so streaming stores should be
+   * used if (and only if) the matrix exceeds the available cache:
+   */
+
+  const std::size_t matrix_bytes =
+      sparsity_simd.n_nonzero_elements() * n_comp * sizeof(double);
+  std::cout << "Streaming store decisions for the matrix:" << std::endl;
+  for (const double factor : {0.5, 2.}) {
+    const auto cache_capacity = cache_capacity_per_rank(
+        MPI_COMM_SELF, std::size_t(factor * matrix_bytes));
+    std::cout << "cache size " << factor << " x matrix: "
+              << use_streaming_store(
+                     WritePolicy::automatic, matrix_bytes, cache_capacity)
+              << std::endl;
+  }
+}
@@ -0,0 +1,176 @@
+#include <hyperbolic_system.h>
+#include <limiter.h>
+#include <multicomponent_vector.h>
+#include <simd.h>
+
+#include <deal.II/base/mpi.h>
+
+#include <iostream>
+#include <random>
+#include <sstream>
+
+using namespace ryujin::Euler;
+using namespace ryujin;
+using namespace dealii;
+
+/*
+ * Compare the bounds computed by the Limiter with the exact specific
+ * entropy of averaged states ("linearized entropy relaxation = false")
+ * and with the linearized lower bound ("linearized entropy relaxation =
+ * true") for stencils sampled from the states of a Sod shock tube and a
+ * Mach 3 flow around a cylinder. The linearized variant must yield
+ * identical density bounds and an entropy bound that is neither weaker
+ * than the exact variant nor stronger than the unrelaxed bound.
+ */
+
+constexpr int dim = 2;
+
+using View = HyperbolicSystem::View<dim, double>;
+using state_type = View::state_type;
+using Limiter = ryujin::Euler::Limiter<dim, double>;
+
+state_type from_primitive(const View &view,
+                          const double rho,
+                          const Tensor<1, dim> &u,
+                          const double p)
+{
+  state_type U;
+  U[0] = rho;
+  for (unsigned int d = 0; d < dim; ++d)
+    U[1 + d] = rho * u[d];
+  U[dim + 1] = p / (view.gamma() - 1.) + 0.5 * rho * u.norm_square();
+  return U;
+}
+
+
+void set_linearized_entropy_relaxation(const bool value)
+{
+  std::stringstream parameters;
+  parameters << "subsection HyperbolicSystem\n"
+             << "set linearized entropy relaxation = "
+             << (value ? "true" : "false") << "\n"
+             << "end" << std::endl;
+  ParameterAcceptor::initialize(parameters);
+}
+
+
+void test(const std::string &name,
+          HyperbolicSystem &hyperbolic_system,
+          const std::vector<state_type> &reference_states)
+{
+  const auto view = hyperbolic_system.view<dim, double>();
+
+  constexpr unsigned int n_nodes = 9;
+  constexpr unsigned int n_stencils = 10000;
+
+  IndexSet locally_owned(n_nodes);
+  locally_owned.add_range(0, n_nodes);
+  const auto scalar_partitioner =
+      std::make_shared<Utilities::MPI::Partitioner>(
+          locally_owned, IndexSet(n_nodes), MPI_COMM_SELF);
+
+  MultiComponentVector<double, View::n_precomputed_values> precomputed;
+  precomputed.reinit_with_scalar_partitioner(scalar_partitioner);
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0., 1.);
+
+  /* A random convex combination of two random reference states: */
+  const auto random_state = [&]() {
+    const auto &U_a =
+        reference_states[generator() % reference_states.size()];
+    const auto &U_b =
+        reference_states[generator() % reference_states.size()];
+    const double theta = distribution(generator);
+    return state_type(theta * U_a + (1. - theta) * U_b);
+  };
+
+  bool density_bounds_agree = true;
+  bool entropy_bound_not_weaker = true;
+  bool entropy_bound_relaxed = true;
+
+  for (unsigned int n = 0; n < n_stencils; ++n) {
+    std::array<state_type, n_nodes> U;
+    std::array<Tensor<1, dim>, n_nodes> c_ij;
+    std::array<double, n_nodes> beta_ij;
+    double s_min_unrelaxed = std::numeric_limits<double>::max();
+
+    for (unsigned int j = 0; j < n_nodes; ++j) {
+      U[j] = random_state();
+      for (unsigned int d = 0; d < dim; ++d)
+        c_ij[j][d] = 0.1 * (2. * distribution(generator) - 1.);
+      beta_ij[j] = 0.1 * distribution(generator);
+
+      View::precomputed_state_type prec_j{};
+      prec_j[0] = view.specific_entropy(U[j]);
+      prec_j[1] = view.harten_entropy(U[j]);
+      precomputed.write_tensor(prec_j, j);
+      s_min_unrelaxed = std::min(s_min_unrelaxed, prec_j[0]);
+    }
+
+    const auto compute_bounds = [&](const bool linearized) {
+      set_linearized_entropy_relaxation(linearized);
+      Limiter limiter(hyperbolic_system, precomputed);
+      limiter.reset(0);
+      for (unsigned int j = 1; j < n_nodes; ++j)
+        limiter.accumulate(&j, U[0], U[j], {}, {}, c_ij[j], beta_ij[j]);
+      limiter.apply_relaxation(/* hd_i */ 1.e-2, /* factor */ 1.);
+      return limiter.bounds();
+    };
+
+    const auto [rho_min, rho_max, s_min] = compute_bounds(false);
+    const auto [rho_min_l, rho_max_l, s_min_l] = compute_bounds(true);
+
+    if (rho_min != rho_min_l || rho_max != rho_max_l)
+      density_bounds_agree = false;
+    /* Allow for round-off in the exact evaluation of the entropy: */
+    if (s_min_l < s_min * (1. - 1.e-12))
+      entropy_bound_not_weaker = false;
+    if (s_min_l > s_min_unrelaxed)
+      entropy_bound_relaxed = false;
+  }
+
+  std::cout << name << ":" << std::endl;
+  std::cout << "  density bounds agree: "
+            << (density_bounds_agree ? "OK" : "FAILED") << std::endl;
+  std::cout << "  entropy bound not weaker than exact relaxation: "
+            << (entropy_bound_not_weaker ? "OK" : "FAILED") << std::endl;
+  std::cout << "  entropy bound not stronger than unrelaxed bound: "
+            << (entropy_bound_relaxed ? "OK" : "FAILED") << std::endl;
+}
+
+
+int main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+
+  HyperbolicSystem hyperbolic_system;
+  const auto view = hyperbolic_system.view<dim, double>();
+
+  /* Sod shock tube: left and right states of the Riemann problem. */
+  {
+    std::vector<state_type> states;
+    states.push_back(from_primitive(view, 1., Tensor<1, dim>(), 1.));
+    states.push_back(from_primitive(view, 0.125, Tensor<1, dim>(), 0.1));
+    test("sod", hyperbolic_system, states);
+  }
+
+  /*
+   * Mach 3 flow around a cylinder: free stream state, the state behind
+   * a normal shock, a stagnation state, and a deflected state.
+   */
+  {
+    Tensor<1, dim> u;
+    std::vector<state_type> states;
+    u[0] = 3.;
+    states.push_back(from_primitive(view, 1.4, u, 1.));
+    u[0] = 0.7778;
+    states.push_back(from_primitive(view, 5.4, u, 10.333));
+    u[0] = 0.;
+    states.push_back(from_primitive(view, 6.2, u, 12.06));
+    u[0] = 2.;
+    u[1] = 2.;
+    states.push_back(from_primitive(view, 1.4, u, 1.));
+    test("mach3 cylinder", hyperbolic_system, states);
+  }
+}
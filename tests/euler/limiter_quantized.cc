@@ -0,0 +1,127 @@
+#include <hyperbolic_system.h>
+#include <limiter.h>
+#include <limiter.template.h>
+#include <simd.h>
+#include <sparse_matrix_simd_quantized.h>
+
+#include <iostream>
+#include <random>
+
+using namespace ryujin::Euler;
+using namespace ryujin;
+using namespace dealii;
+
+/*
+ * Check that storing limiter coefficients l_ij with
+ * QuantizedSparseMatrixSIMD never violates the local bounds on density
+ * and specific entropy for states where the full precision limiter
+ * coefficient does not violate them.
+ */
+
+int main()
+{
+  constexpr int dim = 2;
+
+  using Quantized = QuantizedSparseMatrixSIMD<double>;
+  using Limiter = ryujin::Euler::Limiter<dim, double>;
+  using state_type = Limiter::state_type;
+
+  HyperbolicSystem hyperbolic_system;
+  const auto view = hyperbolic_system.view<dim, double>();
+
+  /*
+   * Quantization alone:
+   */
+
+  bool round_down = true;
+  bool error_bounded = true;
+  for (unsigned int level = 0; level <= Quantized::max_level; ++level) {
+    const double value = Quantized::dequantize(level);
+    for (const double factor : {1. - 1.e-14, 1., 1. + 1.e-14}) {
+      const double l = std::min(value * factor, 1.);
+      const double l_q = Quantized::dequantize(Quantized::quantize(l));
+      if (l_q > l)
+        round_down = false;
+      if (l - l_q > 1. / Quantized::max_level)
+        error_bounded = false;
+    }
+  }
+  std::cout << "quantization rounds down: " << (round_down ? "OK" : "FAILED")
+            << std::endl;
+  std::cout << "quantization error bounded: "
+            << (error_bounded ? "OK" : "FAILED") << std::endl;
+  std::cout << "quantize(NaN) = " << Quantized::quantize(std::nan(""))
+            << ", quantize(-1) = " << Quantized::quantize(-1.)
+            << ", quantize(2) = " << Quantized::quantize(2.) << std::endl;
+
+  /*
+   * Limiter: For random pairs of states U_i, U_j we set up bounds from
+   * the two states and limit the update direction P = 2 (U_j - U_i) that
+   * overshoots U_j. We then compare the bounds violation of the full
+   * precision and the quantized limiter coefficient.
+   */
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0., 1.);
+
+  const auto random_state = [&]() {
+    const double rho = 0.5 + 1.5 * distribution(generator);
+    Tensor<1, dim> u;
+    for (unsigned int d = 0; d < dim; ++d)
+      u[d] = 2. * distribution(generator) - 1.;
+    const double p = 0.5 + 1.5 * distribution(generator);
+
+    state_type U;
+    U[0] = rho;
+    for (unsigned int d = 0; d < dim; ++d)
+      U[1 + d] = rho * u[d];
+    U[dim + 1] = p / (view.gamma() - 1.) + 0.5 * rho * u.norm_square();
+    return U;
+  };
+
+  /* Relative violation of the bounds, negative if bounds are obeyed: */
+  const auto violation = [&](const Limiter::Bounds &bounds,
+                             const state_type &U) {
+    const auto &[rho_min, rho_max, s_min] = bounds;
+    const double rho = view.density(U);
+    const double s = view.specific_entropy(U);
+    return std::max({(rho_min - rho) / rho_min,
+                     (rho - rho_max) / rho_max,
+                     (s_min - s) / s_min});
+  };
+
+  constexpr unsigned int n_samples = 100000;
+  unsigned int n_limited = 0;
+  unsigned int n_failed = 0;
+
+  for (unsigned int n = 0; n < n_samples; ++n) {
+    const auto U_i = random_state();
+    const auto U_j = random_state();
+    const state_type P = 2. * (U_j - U_i);
+
+    const Limiter::Bounds bounds{
+        std::min(view.density(U_i), view.density(U_j)),
+        std::max(view.density(U_i), view.density(U_j)),
+        std::min(view.specific_entropy(U_i), view.specific_entropy(U_j))};
+
+    const auto [l_ij, success] =
+        Limiter::limit(view, bounds, U_i, P, 1.e-10, 10);
+    (void)success;
+
+    const double l_q = Quantized::dequantize(Quantized::quantize(l_ij));
+
+    if (l_ij < 1.)
+      n_limited++;
+
+    const double violation_full = violation(bounds, U_i + l_ij * P);
+    const double violation_quantized = violation(bounds, U_i + l_q * P);
+    if (l_q > l_ij ||
+        violation_quantized > std::max(violation_full, 0.) + 1.e-12)
+      n_failed++;
+  }
+
+  std::cout << "limiter active in more than half of all samples: "
+            << (2 * n_limited > n_samples ? "OK" : "FAILED") << std::endl;
+  std::cout << "quantized l_ij obeys bounds: "
+            << (n_failed == 0 ? "OK" : "FAILED") << std::endl;
+}
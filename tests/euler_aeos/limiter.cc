@@ -0,0 +1,242 @@
+#include <hyperbolic_system.h>
+#include <limiter.h>
+#include <limiter.template.h>
+#include <newton.h>
+#include <simd.h>
+
+#include <deal.II/base/vectorization.h>
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <sstream>
+
+using namespace ryujin::EulerAEOS;
+using namespace ryujin;
+using namespace dealii;
+
+/*
+ * Compare Limiter::limit() against a reference implementation of the
+ * entropy limiting step that evaluates all powers separately (four to
+ * seven pow() calls per Newton iteration) and verify that both
+ * implementations agree.
+ *
+ * As a simple benchmark, we also report the runtime of both
+ * implementations on std::cerr (not part of the test output).
+ */
+
+template <int dim, typename Number>
+std::tuple<Number, bool>
+reference_limit(const HyperbolicSystem::View<dim, Number> &hyperbolic_system,
+                const typename Limiter<dim, Number>::Bounds &bounds,
+                const typename Limiter<dim, Number>::state_type &U,
+                const typename Limiter<dim, Number>::state_type &P,
+                const double newton_tolerance,
+                const unsigned int newton_max_iter)
+{
+  using ScalarNumber = typename get_value_type<Number>::type;
+
+  bool success = true;
+  Number t_r = Number(1.);
+
+  constexpr ScalarNumber eps = std::numeric_limits<ScalarNumber>::epsilon();
+  const ScalarNumber relax_small = ScalarNumber(1. + 10. * eps);
+  const ScalarNumber relax =
+      ScalarNumber(1. + hyperbolic_system.vacuum_state_relaxation() * eps);
+
+  {
+    const auto &rho_U = hyperbolic_system.density(U);
+    const auto &rho_P = hyperbolic_system.density(P);
+    const auto &rho_min = std::get<0>(bounds);
+    const auto &rho_max = std::get<1>(bounds);
+
+    const Number denominator =
+        ScalarNumber(1.) / (std::abs(rho_P) + eps * rho_max);
+    t_r = compare_and_apply_mask<SIMDComparison::less_than>(
+        rho_max,
+        rho_U + t_r * rho_P,
+        (std::abs(rho_max - rho_U) + eps * rho_min) * denominator,
+        t_r);
+    t_r = compare_and_apply_mask<SIMDComparison::less_than>(
+        rho_U + t_r * rho_P,
+        rho_min,
+        (std::abs(rho_min - rho_U) + eps * rho_min) * denominator,
+        t_r);
+    t_r = std::min(t_r, Number(1.));
+    t_r = std::max(t_r, Number(0.));
+  }
+
+  Number t_l = Number(0.);
+
+  const auto &gamma = std::get<3>(bounds);
+  const Number gm1 = gamma - Number(1.);
+  const auto interpolation_b = hyperbolic_system.eos_interpolation_b();
+  const auto &s_min = std::get<2>(bounds);
+
+  for (unsigned int n = 0; n < newton_max_iter; ++n) {
+    const auto U_r = U + t_r * P;
+    const auto rho_r = hyperbolic_system.density(U_r);
+    const auto rho_r_gamma = ryujin::pow(rho_r, gamma);
+    const auto rho_e_r = hyperbolic_system.internal_energy(U_r);
+    const auto covolume_r = Number(1.) - interpolation_b * rho_r;
+
+    auto psi_r = relax_small * rho_r * rho_e_r -
+                 s_min * rho_r * rho_r_gamma * ryujin::pow(covolume_r, -gm1);
+
+    t_l = compare_and_apply_mask<SIMDComparison::greater_than>(
+        psi_r, Number(0.), t_r, t_l);
+    if (t_l == t_r)
+      break;
+
+    const auto U_l = U + t_l * P;
+    const auto rho_l = hyperbolic_system.density(U_l);
+    const auto rho_l_gamma = ryujin::pow(rho_l, gamma);
+    const auto rho_e_l = hyperbolic_system.internal_energy(U_l);
+    const auto covolume_l = Number(1.) - interpolation_b * rho_l;
+
+    auto psi_l = relax_small * rho_l * rho_e_l -
+                 s_min * rho_l * rho_l_gamma * ryujin::pow(covolume_l, -gm1);
+
+    const auto lower_bound = (ScalarNumber(1.) - relax) * s_min * rho_l *
+                             rho_l_gamma * ryujin::pow(covolume_l, -gm1);
+    if (n == 0 && !(std::min(Number(0.), psi_l - lower_bound) == Number(0.)))
+      success = false;
+
+    if (std::max(Number(0.), t_r - t_l - newton_tolerance) == Number(0.))
+      break;
+
+    const auto drho = hyperbolic_system.density(P);
+    const auto drho_e_l = hyperbolic_system.internal_energy_derivative(U_l) * P;
+    const auto drho_e_r = hyperbolic_system.internal_energy_derivative(U_r) * P;
+
+    const auto extra_term_l = s_min * ryujin::pow(rho_l / covolume_l, gamma) *
+                              (covolume_l + gamma - interpolation_b * rho_l);
+    const auto extra_term_r = s_min * ryujin::pow(rho_r / covolume_r, gamma) *
+                              (covolume_r + gamma - interpolation_b * rho_r);
+
+    const auto dpsi_l = rho_l * drho_e_l + (rho_e_l - extra_term_l) * drho;
+    const auto dpsi_r = rho_r * drho_e_r + (rho_e_r - extra_term_r) * drho;
+
+    quadratic_newton_step(t_l, t_r, psi_l, psi_r, dpsi_l, dpsi_r, Number(-1.));
+  }
+
+  return {t_l, success};
+}
+
+
+int main()
+{
+  constexpr int dim = 2;
+  using VA = VectorizedArray<double>;
+  using Limiter = ryujin::EulerAEOS::Limiter<dim, VA>;
+  using state_type = Limiter::state_type;
+
+  HyperbolicSystem hyperbolic_system;
+
+  std::stringstream parameters;
+  parameters << "subsection HyperbolicSystem\n"
+             << "set equation of state = van der waals\n"
+             << "subsection van der waals\n"
+             << "set covolume b = 0.1\n"
+             << "end\n"
+             << "end\n"
+             << std::endl;
+  ParameterAcceptor::initialize(parameters);
+
+  const auto view = hyperbolic_system.view<dim, VA>();
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0., 1.);
+
+  const double gamma = 1.4;
+  const double b = view.eos_interpolation_b();
+
+  /* A random state with positive internal energy and 1 - b rho > 0: */
+  const auto random_state = [&]() {
+    state_type U;
+    for (unsigned int k = 0; k < VA::size(); ++k) {
+      const double rho = 0.5 + 1.5 * distribution(generator);
+      const double p = 0.5 + 1.5 * distribution(generator);
+      U[0][k] = rho;
+      double kinetic = 0.;
+      for (unsigned int d = 0; d < dim; ++d) {
+        const double u = 2. * distribution(generator) - 1.;
+        U[1 + d][k] = rho * u;
+        kinetic += 0.5 * rho * u * u;
+      }
+      U[dim + 1][k] = p * (1. - b * rho) / (gamma - 1.) + kinetic;
+    }
+    return U;
+  };
+
+  constexpr unsigned int n_samples = 10000;
+  constexpr double newton_tolerance = 1.e-10;
+  constexpr unsigned int newton_max_iter = 4;
+
+  std::vector<state_type> U_i(n_samples), P(n_samples);
+  std::vector<Limiter::Bounds> bounds(n_samples);
+
+  for (unsigned int n = 0; n < n_samples; ++n) {
+    U_i[n] = random_state();
+    const auto U_j = random_state();
+    /* Overshoot U_j in order to trigger limiting: */
+    P[n] = 2. * (U_j - U_i[n]);
+
+    const VA gamma_min = gamma;
+    bounds[n] = {std::min(view.density(U_i[n]), view.density(U_j)),
+                 std::max(view.density(U_i[n]), view.density(U_j)),
+                 std::min(view.surrogate_specific_entropy(U_i[n], gamma_min),
+                          view.surrogate_specific_entropy(U_j, gamma_min)),
+                 gamma_min};
+  }
+
+  std::vector<VA> t_new(n_samples), t_reference(n_samples);
+  std::vector<bool> success_new(n_samples), success_reference(n_samples);
+
+  constexpr unsigned int n_repetitions = 10;
+
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned int r = 0; r < n_repetitions; ++r)
+    for (unsigned int n = 0; n < n_samples; ++n) {
+      const auto [t, success] = Limiter::limit(
+          view, bounds[n], U_i[n], P[n], newton_tolerance, newton_max_iter);
+      t_new[n] = t;
+      success_new[n] = success;
+    }
+  const std::chrono::duration<double> time_new =
+      std::chrono::steady_clock::now() - start;
+
+  start = std::chrono::steady_clock::now();
+  for (unsigned int r = 0; r < n_repetitions; ++r)
+    for (unsigned int n = 0; n < n_samples; ++n) {
+      const auto [t, success] = reference_limit(
+          view, bounds[n], U_i[n], P[n], newton_tolerance, newton_max_iter);
+      t_reference[n] = t;
+      success_reference[n] = success;
+    }
+  const std::chrono::duration<double> time_reference =
+      std::chrono::steady_clock::now() - start;
+
+  std::cerr << "Limiter::limit(): " << time_new.count() << "s, reference "
+            << time_reference.count() << "s, speedup "
+            << time_reference.count() / time_new.count() << std::endl;
+
+  bool agree = true;
+  unsigned int n_limited = 0;
+  for (unsigned int n = 0; n < n_samples; ++n) {
+    if (success_new[n] != success_reference[n])
+      agree = false;
+    for (unsigned int k = 0; k < VA::size(); ++k) {
+      if (std::abs(t_new[n][k] - t_reference[n][k]) > 1.e-8)
+        agree = false;
+      if (t_new[n][k] < 1.)
+        n_limited++;
+    }
+  }
+
+  std::cout << "limiter active in more than half of all samples: "
+            << (2 * n_limited > n_samples * VA::size() ? "OK" : "FAILED")
+            << std::endl;
+  std::cout << "Limiter::limit() agrees with reference: "
+            << (agree ? "OK" : "FAILED") << std::endl;
+}
@@ -0,0 +1,182 @@
+#include <compile_time_options.h>
+#include <description.h>
+#include <time_loop.h>
+
+#include <deal.II/base/mpi.h>
+
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <sstream>
+
+using namespace ryujin;
+using namespace dealii;
+
+/*
+ * Run two cases of the Becker solution in batch mode, i.e., with a
+ * single TimeLoop object and the parameters of the second case parsed on
+ * top of the first ones (see EquationDispatch::run()). The second case
+ * only changes the CFL number, enables geometric multigrid and changes
+ * the basename. It thus shares the discretization and offline data
+ * subsections with the first case, and TimeLoop::run() reuses the mesh
+ * and the offline data.
+ *
+ * The final time and the L1 error of the second case have to agree with
+ * a fresh run of a new TimeLoop object with the combined parameters.
+ */
+
+static const std::string case_1 = R"(
+subsection A - TimeLoop
+  set basename                  = batch_mode-1
+  set enable compute error      = true
+  set error quantities          = rho, m_1, E
+  set final time                = 0.5
+  set output granularity        = 0.5
+  set terminal update interval  = 0
+end
+subsection B - Equation
+  set gamma    = 1.4
+  set mu       = 0.01
+  set lambda   = 0
+  set kappa    = 1.866666666666666e-2
+end
+subsection C - Discretization
+  set geometry        = rectangular domain
+  set mesh refinement = 4
+  subsection rectangular domain
+    set boundary condition bottom = periodic
+    set boundary condition left   = dirichlet
+    set boundary condition right  = dirichlet
+    set boundary condition top    = periodic
+    set position bottom left      = -0.25, -0.25
+    set position top right        =  0.25,  0.25
+  end
+end
+subsection E - InitialValues
+  set configuration = becker solution
+  set direction     = 1,      0
+  set position      = -0.125, 0
+  subsection becker solution
+    set mu                      = 0.01
+    set velocity galilean frame = 0.125
+    set density left            = 1
+    set velocity left           = 1
+    set velocity right          = 0.259259259259
+  end
+end
+subsection F - HyperbolicModule
+  set cfl with boundary dofs = false
+  set limiter iterations     = 2
+end
+subsection G - ParabolicModule
+  set tolerance             = 1e-13
+  set tolerance linfty norm = false
+end
+subsection H - TimeIntegrator
+  set cfl min               = 0.30
+  set cfl max               = 0.30
+  set cfl recovery strategy = none
+  set time stepping scheme  = strang erk 33 cn
+end
+)";
+
+static const std::string case_2 = R"(
+subsection A - TimeLoop
+  set basename = batch_mode-2
+end
+subsection G - ParabolicModule
+  set multigrid velocity = true
+  set multigrid energy   = true
+end
+subsection H - TimeIntegrator
+  set cfl min = 0.20
+  set cfl max = 0.20
+end
+)";
+
+
+/*
+ * Parse @p parameters on top of the current parameters, run the time
+ * loop, and return the final time and the L1 error as printed by the
+ * time loop. The terminal output of the time loop is discarded.
+ */
+template <typename TIME_LOOP>
+std::pair<std::string, double> run(TIME_LOOP &time_loop,
+                                   const std::string &parameters)
+{
+  std::stringstream input(parameters);
+  ParameterAcceptor::initialize(input);
+
+  std::stringstream output;
+  struct Redirect {
+    Redirect(std::streambuf *buffer)
+        : buffer_(std::cout.rdbuf(buffer))
+    {
+    }
+    ~Redirect()
+    {
+      std::cout.rdbuf(buffer_);
+    }
+    std::streambuf *buffer_;
+  };
+
+  {
+    Redirect redirect(output.rdbuf());
+    time_loop.run();
+  }
+
+  std::string t;
+  double error = std::numeric_limits<double>::quiet_NaN();
+  for (std::string line; std::getline(output, line);) {
+    if (line.rfind("t     = ", 0) == 0)
+      t = line.substr(8);
+    if (line.rfind("L1    = ", 0) == 0)
+      error = std::stod(line.substr(8));
+  }
+
+  return {t, error};
+}
+
+
+int main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  const MPI_Comm mpi_communicator = MPI_COMM_WORLD;
+
+  static_assert(DIM == 2, "The test is set up for two spatial dimensions");
+
+  using TimeLoop = ryujin::TimeLoop<NavierStokes::Description, DIM, NUMBER>;
+
+  std::pair<std::string, double> batch_1, batch_2, fresh_2;
+  {
+    TimeLoop time_loop(mpi_communicator);
+    batch_1 = run(time_loop, case_1);
+    batch_2 = run(time_loop, case_2);
+  }
+  {
+    TimeLoop time_loop(mpi_communicator);
+    fresh_2 = run(time_loop, case_1 + case_2);
+  }
+
+  const auto &[t_1, error_1] = batch_1;
+  const auto &[t_2, error_2] = batch_2;
+  const auto &[fresh_t_2, fresh_error_2] = fresh_2;
+
+  std::cout << "case 1, error finite: "
+            << (std::isfinite(error_1) && error_1 > 0. ? "OK" : "FAILED")
+            << std::endl;
+  std::cout << "case 2, error differs from case 1: "
+            << (std::isfinite(error_2) && error_2 != error_1 ? "OK"
+                                                              : "FAILED")
+            << std::endl;
+  std::cout << "case 2, final time agrees with a fresh run: "
+            << (!t_2.empty() && t_2 == fresh_t_2 ? "OK" : "FAILED")
+            << std::endl;
+  std::cout << "case 2, error agrees with a fresh run: "
+            << (std::isfinite(error_2) &&
+                        std::abs(error_2 - fresh_error_2) <=
+                            1.e-10 * fresh_error_2
+                    ? "OK"
+                    : "FAILED")
+            << std::endl;
+}
@@ -0,0 +1,219 @@
+#include <compile_time_options.h>
+#include <description.h>
+#include <discretization.h>
+#include <initial_values.h>
+#include <offline_data.h>
+#include <parabolic_module.template.h>
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+using namespace ryujin;
+using namespace dealii;
+
+/*
+ * Compare the multigrid coarse solvers "chebyshev", "amg", and "direct"
+ * of the parabolic solver for a backward Euler step of the manufactured
+ * solution of imex_manufactured.cc (a state at rest with internal energy
+ * e_0 + A cos(2 pi x) on a periodic unit square). The exact amplitude
+ * ratio is 0.504085.
+ *
+ * After resetting the solver statistics a single step sets the average
+ * internal energy iteration count to 0.1 times the number of GMG
+ * iterations. Every coarse solver has to converge without falling back
+ * to the diagonally preconditioned CG solver, and the assembled coarse
+ * solvers have to reproduce the iteration count of the Chebyshev coarse
+ * solver (up to one iteration): the minimal level is the 2x2 coarse mesh
+ * on which all three solvers are (close to) exact. Without Trilinos the
+ * amg and direct coarse solvers have to be rejected by prepare().
+ */
+
+constexpr int dim = DIM;
+using Number = NUMBER;
+using Description = NavierStokes::Description;
+
+static const std::string base_parameters = R"(
+subsection B - Equation
+  set gamma    = 1.4
+  set mu       = 0.01
+  set lambda   = 0
+  set kappa    = 0.1
+end
+subsection C - Discretization
+  set geometry        = rectangular domain
+  set mesh refinement = 4
+  subsection rectangular domain
+    set boundary condition bottom = periodic
+    set boundary condition left   = periodic
+    set boundary condition right  = periodic
+    set boundary condition top    = periodic
+    set position bottom left      = 0, 0
+    set position top right        = 1, 1
+    set subdivisions x            = 2
+    set subdivisions y            = 2
+  end
+end
+subsection G - ParabolicModule
+  set tolerance                   = 1e-13
+  set tolerance linfty norm       = false
+  set multigrid velocity          = true
+  set multigrid energy            = true
+  set multigrid energy - max iter = 50
+end
+)";
+
+
+int main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  const MPI_Comm mpi_communicator = MPI_COMM_WORLD;
+
+  static_assert(dim == 2, "The test is set up for two spatial dimensions");
+  static_assert(Discretization<dim>::order_finite_element == 1,
+                "The manufactured solution requires Q1 elements");
+
+  std::map<std::string, dealii::Timer> computing_timer;
+
+  Description::HyperbolicSystem hyperbolic_system("/B - Equation");
+  Description::ParabolicSystem parabolic_system("/B - Equation");
+  Discretization<dim> discretization(mpi_communicator, "/C - Discretization");
+  OfflineData<dim, Number> offline_data(
+      mpi_communicator, discretization, "/D - OfflineData");
+  InitialValues<Description, dim, Number> initial_values(
+      hyperbolic_system, offline_data, "/E - InitialValues");
+  ParabolicModule<Description, dim, Number> parabolic_module(
+      mpi_communicator,
+      computing_timer,
+      offline_data,
+      hyperbolic_system,
+      parabolic_system,
+      initial_values,
+      "/G - ParabolicModule");
+
+  using vector_type = ParabolicModule<Description, dim, Number>::vector_type;
+  using scalar_type = OfflineData<dim, Number>::scalar_type;
+
+  {
+    std::stringstream input(base_parameters);
+    ParameterAcceptor::initialize(input);
+  }
+
+  discretization.prepare();
+  offline_data.prepare(dim + 2);
+
+  const auto &scalar_partitioner = offline_data.scalar_partitioner();
+  const auto &affine_constraints = offline_data.affine_constraints();
+  const unsigned int n_owned = offline_data.n_locally_owned();
+
+  /* The nodal interpolant of the mode cos(2 pi x): */
+  scalar_type mode;
+  mode.reinit(scalar_partitioner);
+  VectorTools::interpolate(offline_data.dof_handler(),
+                           ScalarFunctionFromFunctionObject<dim, Number>(
+                               [](const Point<dim> &point) {
+                                 return std::cos(2. * M_PI * point[0]);
+                               }),
+                           mode);
+
+  constexpr Number e_0 = 1.;
+  constexpr Number amplitude = 0.1;
+
+  vector_type old_U;
+  old_U.reinit(offline_data.vector_partitioner());
+  for (unsigned int i = 0; i < n_owned; ++i) {
+    Tensor<1, dim + 2, Number> U_i;
+    U_i[0] = Number(1.);
+    U_i[dim + 1] = e_0 + amplitude * mode.local_element(i);
+    old_U.write_tensor(U_i, i);
+  }
+  old_U.update_ghost_values();
+
+  /* Least squares fit of the amplitude of the mode in U: */
+  const auto amplitude_of = [&](const vector_type &U) {
+    const auto view = hyperbolic_system.view<dim, Number>();
+    double numerator = 0.;
+    double denominator = 0.;
+    for (unsigned int i = 0; i < n_owned; ++i) {
+      if (affine_constraints.is_constrained(
+              scalar_partitioner->local_to_global(i)))
+        continue;
+      const auto U_i = U.get_tensor(i);
+      const auto e_i = view.internal_energy(U_i) / view.density(U_i);
+      const auto c_i = mode.local_element(i);
+      numerator += (e_i - e_0) * c_i;
+      denominator += c_i * c_i;
+    }
+    numerator = Utilities::MPI::sum(numerator, mpi_communicator);
+    denominator = Utilities::MPI::sum(denominator, mpi_communicator);
+    return numerator / denominator;
+  };
+
+  /*
+   * The number of internal energy iterations of the last step, recovered
+   * from the status line "[ v GMG vel -- e GMG int ]" of the solver
+   * statistics:
+   */
+  const auto iterations = [&]() {
+    std::stringstream statistics;
+    parabolic_module.print_solver_statistics(statistics);
+    std::string bracket, velocity, gmg, vel, dashes, energy;
+    statistics >> bracket >> velocity >> gmg >> vel >> dashes >> energy;
+    return static_cast<unsigned int>(std::round(10. * std::stod(energy)));
+  };
+
+  constexpr Number tau = 0.25;
+  vector_type new_U;
+  new_U.reinit(offline_data.vector_partitioner());
+
+  unsigned int reference_iterations = 0;
+
+  for (const std::string coarse_solver : {"chebyshev", "amg", "direct"}) {
+    std::stringstream input;
+    input << base_parameters << "subsection G - ParabolicModule\n"
+          << "  set multigrid - coarse solver = " << coarse_solver
+          << "\nend\n";
+    ParameterAcceptor::initialize(input);
+
+#ifndef DEAL_II_WITH_TRILINOS
+    if (coarse_solver != "chebyshev") {
+      bool rejected = false;
+      try {
+        parabolic_module.prepare();
+      } catch (ExceptionBase &) {
+        rejected = true;
+      }
+      std::cout << coarse_solver << ": rejected without Trilinos: "
+                << (rejected ? "OK" : "FAILED") << std::endl;
+      continue;
+    }
+#endif
+
+    parabolic_module.prepare();
+    parabolic_module.reset_statistics();
+
+    parabolic_module.step<0>(old_U, 0., {}, {}, new_U, tau, 0);
+    new_U.update_ghost_values();
+
+    const unsigned int n_iterations = iterations();
+    if (coarse_solver == "chebyshev")
+      reference_iterations = n_iterations;
+
+    std::cout << coarse_solver << ": amplitude ratio " << std::fixed
+              << std::setprecision(6) << amplitude_of(new_U) / amplitude
+              << std::endl;
+    std::cout << coarse_solver << ": GMG converged: "
+              << (n_iterations > 0 && n_iterations < 50 ? "OK" : "FAILED")
+              << std::endl;
+    std::cout << coarse_solver << ": iterations agree with chebyshev: "
+              << (n_iterations <= reference_iterations + 1 &&
+                          reference_iterations <= n_iterations + 1
+                      ? "OK"
+                      : "FAILED")
+              << std::endl;
+  }
+}
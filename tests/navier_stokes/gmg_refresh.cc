@@ -0,0 +1,191 @@
+#include <compile_time_options.h>
+#include <description.h>
+#include <discretization.h>
+#include <initial_values.h>
+#include <offline_data.h>
+#include <parabolic_module.template.h>
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <utility>
+
+using namespace ryujin;
+using namespace dealii;
+
+/*
+ * Test the refresh policy of the geometric multigrid level operators:
+ * Perform a sequence of steps of the manufactured solution of
+ * imex_manufactured.cc (a state at rest with constant density and
+ * internal energy e_0 + A cos(2 pi x) on a periodic unit square) and
+ * print the number of multigrid rebuilds after every step:
+ *
+ *  1. backward Euler, tau = 0.25: first step, rebuild;
+ *  2. backward Euler, tau = 0.26: 4% change, no rebuild;
+ *  3. IMEX stage with explicit weight 1/2, tau = 0.25, stage 1: the
+ *     reference is scaled by the implicit weight, no rebuild;
+ *  4. Crank-Nicolson, tau = 0.25: the reference is scaled by theta, no
+ *     rebuild;
+ *  5. backward Euler, tau = 0.30: 20% change, rebuild.
+ *
+ * The density does not change. With a refresh tolerance of 0 the level
+ * operators are rebuilt in every step.
+ */
+
+constexpr int dim = DIM;
+using Number = NUMBER;
+using Description = NavierStokes::Description;
+
+static const std::string base_parameters = R"(
+subsection B - Equation
+  set gamma    = 1.4
+  set mu       = 0.01
+  set lambda   = 0
+  set kappa    = 0.1
+end
+subsection C - Discretization
+  set geometry        = rectangular domain
+  set mesh refinement = 4
+  subsection rectangular domain
+    set boundary condition bottom = periodic
+    set boundary condition left   = periodic
+    set boundary condition right  = periodic
+    set boundary condition top    = periodic
+    set position bottom left      = 0, 0
+    set position top right        = 1, 1
+    set subdivisions x            = 2
+    set subdivisions y            = 2
+  end
+end
+subsection G - ParabolicModule
+  set tolerance                   = 1e-13
+  set tolerance linfty norm       = false
+  set multigrid velocity          = true
+  set multigrid energy            = true
+  set multigrid energy - max iter = 50
+end
+)";
+
+
+int main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  const MPI_Comm mpi_communicator = MPI_COMM_WORLD;
+
+  static_assert(dim == 2, "The test is set up for two spatial dimensions");
+  static_assert(Discretization<dim>::order_finite_element == 1,
+                "The manufactured solution requires Q1 elements");
+
+  std::map<std::string, dealii::Timer> computing_timer;
+
+  Description::HyperbolicSystem hyperbolic_system("/B - Equation");
+  Description::ParabolicSystem parabolic_system("/B - Equation");
+  Discretization<dim> discretization(mpi_communicator, "/C - Discretization");
+  OfflineData<dim, Number> offline_data(
+      mpi_communicator, discretization, "/D - OfflineData");
+  InitialValues<Description, dim, Number> initial_values(
+      hyperbolic_system, offline_data, "/E - InitialValues");
+  ParabolicModule<Description, dim, Number> parabolic_module(
+      mpi_communicator,
+      computing_timer,
+      offline_data,
+      hyperbolic_system,
+      parabolic_system,
+      initial_values,
+      "/G - ParabolicModule");
+
+  using vector_type = ParabolicModule<Description, dim, Number>::vector_type;
+  using scalar_type = OfflineData<dim, Number>::scalar_type;
+
+  {
+    std::stringstream input(base_parameters);
+    ParameterAcceptor::initialize(input);
+  }
+
+  discretization.prepare();
+  offline_data.prepare(dim + 2);
+
+  const auto &scalar_partitioner = offline_data.scalar_partitioner();
+  const unsigned int n_owned = offline_data.n_locally_owned();
+
+  /* The nodal interpolant of the mode cos(2 pi x): */
+  scalar_type mode;
+  mode.reinit(scalar_partitioner);
+  VectorTools::interpolate(offline_data.dof_handler(),
+                           ScalarFunctionFromFunctionObject<dim, Number>(
+                               [](const Point<dim> &point) {
+                                 return std::cos(2. * M_PI * point[0]);
+                               }),
+                           mode);
+
+  constexpr Number e_0 = 1.;
+  constexpr Number amplitude = 0.1;
+
+  vector_type old_U;
+  old_U.reinit(offline_data.vector_partitioner());
+  for (unsigned int i = 0; i < n_owned; ++i) {
+    Tensor<1, dim + 2, Number> U_i;
+    U_i[0] = Number(1.);
+    U_i[dim + 1] = e_0 + amplitude * mode.local_element(i);
+    old_U.write_tensor(U_i, i);
+  }
+  old_U.update_ghost_values();
+
+  /*
+   * The number of velocity and internal energy multigrid rebuilds,
+   * recovered from the status line
+   * "[ v GMG vel -- e GMG int ] [ r vel -- s int GMG rebuilds ]" of the
+   * solver statistics:
+   */
+  const auto rebuilds = [&]() {
+    std::stringstream statistics;
+    parabolic_module.print_solver_statistics(statistics);
+    std::string token;
+    for (unsigned int k = 0; k < 10; ++k)
+      statistics >> token;
+    unsigned int velocity, energy;
+    statistics >> velocity >> token >> token >> energy;
+    return std::make_pair(velocity, energy);
+  };
+
+  vector_type new_U;
+  new_U.reinit(offline_data.vector_partitioner());
+
+  for (const double tolerance : {0.05, 0.}) {
+    std::stringstream input;
+    input << base_parameters << "subsection G - ParabolicModule\n"
+          << "  set multigrid - refresh tolerance = " << tolerance
+          << "\nend\n";
+    ParameterAcceptor::initialize(input);
+
+    parabolic_module.prepare();
+    parabolic_module.reset_statistics();
+
+    std::cout << "refresh tolerance " << tolerance << ":" << std::endl;
+
+    const auto print = [&](const std::string &name) {
+      const auto [velocity, energy] = rebuilds();
+      std::cout << "  " << name << ": " << velocity << " vel -- " << energy
+                << " int GMG rebuilds" << std::endl;
+    };
+
+    parabolic_module.step<0>(old_U, 0., {}, {}, new_U, 0.25, 0);
+    print("backward euler, tau 0.25");
+
+    parabolic_module.step<0>(old_U, 0., {}, {}, new_U, 0.26, 0);
+    print("backward euler, tau 0.26");
+
+    parabolic_module.step<1>(
+        old_U, 0., {{old_U}}, {{Number(0.5)}}, new_U, 0.25, 1);
+    print("stage weights 1/2, tau 0.25");
+
+    parabolic_module.crank_nicolson_step(old_U, 0., new_U, 0.25);
+    print("crank nicolson, tau 0.25");
+
+    parabolic_module.step<0>(old_U, 0., {}, {}, new_U, 0.30, 0);
+    print("backward euler, tau 0.30");
+  }
+}
@@ -0,0 +1,191 @@
+#include <compile_time_options.h>
+#include <description.h>
+#include <time_loop.h>
+
+#include <deal.II/base/mpi.h>
+
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <utility>
+
+using namespace ryujin;
+using namespace dealii;
+
+/*
+ * Measure the temporal order of convergence of the IMEX schemes "imex
+ * 11", "imex 22", and "imex 32" for the Becker solution.
+ *
+ * The mesh is fixed and the time-step size is halved twice by halving
+ * the CFL number. Because the spatial error is identical for all three
+ * runs, the differences of the L1 errors at final time only contain the
+ * temporal error, and
+ *
+ *   p = log2((E(cfl) - E(cfl / 2)) / (E(cfl / 2) - E(cfl / 4)))
+ *
+ * is the observed order. The time-step size is determined by the
+ * (constant) states next to the Dirichlet boundaries and therefore
+ * constant during a run. We first perform a single step to determine the
+ * step size and then choose the final time such that all runs end
+ * precisely at the same time.
+ *
+ * The observed orders are reported on std::cerr (not part of the test
+ * output).
+ */
+
+static const std::string base_parameters = R"(
+subsection A - TimeLoop
+  set basename                  = imex_convergence
+  set enable compute error      = true
+  set error quantities          = rho, m_1, E
+  set output granularity        = 1
+  set terminal update interval  = 0
+end
+subsection B - Equation
+  set gamma    = 1.4
+  set mu       = 0.01
+  set lambda   = 0
+  set kappa    = 1.866666666666666e-2
+end
+subsection C - Discretization
+  set geometry        = rectangular domain
+  set mesh refinement = 4
+  subsection rectangular domain
+    set boundary condition bottom = periodic
+    set boundary condition left   = dirichlet
+    set boundary condition right  = dirichlet
+    set boundary condition top    = periodic
+    set position bottom left      = -0.25, -0.25
+    set position top right        =  0.25,  0.25
+  end
+end
+subsection E - InitialValues
+  set configuration = becker solution
+  set direction     = 1,      0
+  set position      = -0.125, 0
+  subsection becker solution
+    set mu                      = 0.01
+    set velocity galilean frame = 0.125
+    set density left            = 1
+    set velocity left           = 1
+    set velocity right          = 0.259259259259
+  end
+end
+subsection F - HyperbolicModule
+  set cfl with boundary dofs = false
+  set limiter iterations     = 2
+end
+subsection G - ParabolicModule
+  set tolerance                 = 1e-13
+  set tolerance linfty norm     = false
+  set extrapolation order       = 0
+end
+subsection H - TimeIntegrator
+  set cfl recovery strategy = none
+end
+)";
+
+
+/*
+ * Run the time loop with the base parameters amended by the time
+ * stepping scheme @p scheme, the CFL number @p cfl and the final time
+ * @p final_time. Return the time reached by the time loop and the L1
+ * error at that time. The terminal output of the time loop is discarded.
+ */
+template <typename TIME_LOOP>
+std::pair<double, double> run(TIME_LOOP &time_loop,
+                              const std::string &scheme,
+                              const double cfl,
+                              const double final_time)
+{
+  std::stringstream parameters;
+  parameters << std::setprecision(17);
+  parameters << base_parameters;
+  parameters << "subsection A - TimeLoop\n"
+             << "  set final time = " << final_time << "\nend\n";
+  parameters << "subsection H - TimeIntegrator\n"
+             << "  set cfl min              = " << cfl << "\n"
+             << "  set cfl max              = " << cfl << "\n"
+             << "  set time stepping scheme = " << scheme << "\nend\n";
+  ParameterAcceptor::initialize(parameters);
+
+  std::stringstream output;
+  struct Redirect {
+    Redirect(std::streambuf *buffer)
+        : buffer_(std::cout.rdbuf(buffer))
+    {
+    }
+    ~Redirect()
+    {
+      std::cout.rdbuf(buffer_);
+    }
+    std::streambuf *buffer_;
+  };
+
+  {
+    Redirect redirect(output.rdbuf());
+    time_loop.run();
+  }
+
+  double t = std::numeric_limits<double>::quiet_NaN();
+  double error = std::numeric_limits<double>::quiet_NaN();
+  for (std::string line; std::getline(output, line);) {
+    if (line.rfind("t     = ", 0) == 0)
+      t = std::stod(line.substr(8));
+    if (line.rfind("L1    = ", 0) == 0)
+      error = std::stod(line.substr(8));
+  }
+
+  return {t, error};
+}
+
+
+int main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  const MPI_Comm mpi_communicator = MPI_COMM_WORLD;
+
+  static_assert(DIM == 2, "The test is set up for two spatial dimensions");
+
+  TimeLoop<NavierStokes::Description, DIM, NUMBER> time_loop(
+      mpi_communicator);
+
+  constexpr double cfl = 0.4;
+  constexpr unsigned int n_steps = 8;
+
+  for (const auto &[scheme, order] : {std::make_pair("imex 11", 1.),
+                                      std::make_pair("imex 22", 2.),
+                                      std::make_pair("imex 32", 2.)}) {
+
+    /* A single step determines the (constant) step size: */
+    const double step_size = run(time_loop, scheme, cfl, 1.e-12).first;
+    const double final_time = (n_steps - 0.5) * step_size;
+
+    double errors[3];
+    bool same_final_time = true;
+    for (unsigned int i = 0; i < 3; ++i) {
+      const auto [t, error] =
+          run(time_loop, scheme, cfl / (1 << i), final_time);
+      same_final_time &=
+          std::abs(t - n_steps * step_size) <= 1.e-8 * n_steps * step_size;
+      errors[i] = error;
+    }
+
+    const double observed_order =
+        std::log2((errors[0] - errors[1]) / (errors[1] - errors[2]));
+
+    std::cerr << scheme << ": observed order " << observed_order
+              << std::endl;
+
+    std::cout << scheme << ", same final time: "
+              << (same_final_time ? "OK" : "FAILED") << std::endl;
+    std::cout << scheme << ", order " << order << ": "
+              << (std::isfinite(observed_order) &&
+                          observed_order > order - 0.25
+                      ? "OK"
+                      : "FAILED")
+              << std::endl;
+  }
+}
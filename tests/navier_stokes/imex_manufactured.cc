@@ -0,0 +1,193 @@
+#include <compile_time_options.h>
+#include <description.h>
+#include <discretization.h>
+#include <initial_values.h>
+#include <offline_data.h>
+#include <parabolic_module.template.h>
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+using namespace ryujin;
+using namespace dealii;
+
+/*
+ * A manufactured solution for the implicit stages of the IMEX schemes:
+ *
+ * For a state at rest with constant density rho = 1 and internal energy
+ * e = e_0 + A cos(2 pi x) on a periodic unit square the parabolic
+ * subsystem reduces to the heat equation e_t = c_v^{-1} kappa Delta e.
+ * On a uniform mesh with Q1 elements and lumped mass matrix the nodal
+ * interpolant of cos(2 pi x) is an eigenvector of the discrete operator
+ * with eigenvalue
+ *
+ *   lambda_h = 4 sin^2(pi h) / h^2.
+ *
+ * With z = tau c_v^{-1} kappa lambda_h a stage with explicit weights w_s
+ * thus multiplies the amplitude A by
+ *
+ *   (1 - sum_s w_s z) / (1 + (1 - sum_s w_s) z),
+ *
+ * and a Crank-Nicolson step by (1 - z / 2) / (1 + z / 2). We print the
+ * amplitude ratios computed by ParabolicModule::step() and
+ * ParabolicModule::crank_nicolson_step(). For h = 1/32, tau = 0.25 and
+ * c_v^{-1} kappa = 0.1 the exact values are 0.504085 (backward Euler),
+ * 0.340575 (w = 1/2, and Crank-Nicolson), and 0.210406 (w = 3/4, and
+ * w = 1/4, 1/2).
+ */
+
+constexpr int dim = DIM;
+using Number = NUMBER;
+using Description = NavierStokes::Description;
+
+static const std::string parameters = R"(
+subsection B - Equation
+  set gamma    = 1.4
+  set mu       = 0.01
+  set lambda   = 0
+  set kappa    = 0.1
+end
+subsection C - Discretization
+  set geometry        = rectangular domain
+  set mesh refinement = 4
+  subsection rectangular domain
+    set boundary condition bottom = periodic
+    set boundary condition left   = periodic
+    set boundary condition right  = periodic
+    set boundary condition top    = periodic
+    set position bottom left      = 0, 0
+    set position top right        = 1, 1
+    set subdivisions x            = 2
+    set subdivisions y            = 2
+  end
+end
+subsection G - ParabolicModule
+  set tolerance             = 1e-13
+  set tolerance linfty norm = false
+end
+)";
+
+
+int main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  const MPI_Comm mpi_communicator = MPI_COMM_WORLD;
+
+  static_assert(dim == 2, "The test is set up for two spatial dimensions");
+  static_assert(Discretization<dim>::order_finite_element == 1,
+                "The manufactured solution requires Q1 elements");
+
+  std::map<std::string, dealii::Timer> computing_timer;
+
+  Description::HyperbolicSystem hyperbolic_system("/B - Equation");
+  Description::ParabolicSystem parabolic_system("/B - Equation");
+  Discretization<dim> discretization(mpi_communicator, "/C - Discretization");
+  OfflineData<dim, Number> offline_data(
+      mpi_communicator, discretization, "/D - OfflineData");
+  InitialValues<Description, dim, Number> initial_values(
+      hyperbolic_system, offline_data, "/E - InitialValues");
+  ParabolicModule<Description, dim, Number> parabolic_module(
+      mpi_communicator,
+      computing_timer,
+      offline_data,
+      hyperbolic_system,
+      parabolic_system,
+      initial_values,
+      "/G - ParabolicModule");
+
+  using vector_type = ParabolicModule<Description, dim, Number>::vector_type;
+  using scalar_type = OfflineData<dim, Number>::scalar_type;
+
+  std::stringstream input(parameters);
+  ParameterAcceptor::initialize(input);
+
+  discretization.prepare();
+  offline_data.prepare(dim + 2);
+  parabolic_module.prepare();
+
+  const auto &scalar_partitioner = offline_data.scalar_partitioner();
+  const auto &affine_constraints = offline_data.affine_constraints();
+  const unsigned int n_owned = offline_data.n_locally_owned();
+
+  /* The nodal interpolant of the mode cos(2 pi x): */
+  scalar_type mode;
+  mode.reinit(scalar_partitioner);
+  VectorTools::interpolate(offline_data.dof_handler(),
+                           ScalarFunctionFromFunctionObject<dim, Number>(
+                               [](const Point<dim> &point) {
+                                 return std::cos(2. * M_PI * point[0]);
+                               }),
+                           mode);
+
+  constexpr Number e_0 = 1.;
+  constexpr Number amplitude = 0.1;
+
+  vector_type old_U;
+  old_U.reinit(offline_data.vector_partitioner());
+  for (unsigned int i = 0; i < n_owned; ++i) {
+    Tensor<1, dim + 2, Number> U_i;
+    U_i[0] = Number(1.);
+    U_i[dim + 1] = e_0 + amplitude * mode.local_element(i);
+    old_U.write_tensor(U_i, i);
+  }
+  old_U.update_ghost_values();
+
+  /* Least squares fit of the amplitude of the mode in U: */
+  const auto amplitude_of = [&](const vector_type &U) {
+    const auto view = hyperbolic_system.view<dim, Number>();
+    double numerator = 0.;
+    double denominator = 0.;
+    for (unsigned int i = 0; i < n_owned; ++i) {
+      if (affine_constraints.is_constrained(
+              scalar_partitioner->local_to_global(i)))
+        continue;
+      const auto U_i = U.get_tensor(i);
+      const auto e_i = view.internal_energy(U_i) / view.density(U_i);
+      const auto c_i = mode.local_element(i);
+      numerator += (e_i - e_0) * c_i;
+      denominator += c_i * c_i;
+    }
+    numerator = Utilities::MPI::sum(numerator, mpi_communicator);
+    denominator = Utilities::MPI::sum(denominator, mpi_communicator);
+    return numerator / denominator;
+  };
+
+  constexpr Number tau = 0.25;
+  vector_type new_U;
+  new_U.reinit(offline_data.vector_partitioner());
+
+  const auto print = [&](const std::string &name) {
+    new_U.update_ghost_values();
+    std::cout << name << ": amplitude ratio " << std::fixed
+              << std::setprecision(6) << amplitude_of(new_U) / amplitude
+              << std::endl;
+  };
+
+  parabolic_module.step<0>(old_U, 0., {}, {}, new_U, tau, 0);
+  print("backward euler");
+
+  parabolic_module.step<1>(
+      old_U, 0., {{old_U}}, {{Number(0.5)}}, new_U, tau, 1);
+  print("stage weights 1/2");
+
+  parabolic_module.step<1>(
+      old_U, 0., {{old_U}}, {{Number(0.75)}}, new_U, tau, 2);
+  print("stage weights 3/4");
+
+  parabolic_module.step<2>(old_U,
+                           0.,
+                           {{old_U, old_U}},
+                           {{Number(0.25), Number(0.5)}},
+                           new_U,
+                           tau,
+                           3);
+  print("stage weights 1/4, 1/2");
+
+  parabolic_module.crank_nicolson_step(old_U, 0., new_U, tau);
+  print("crank nicolson");
+}
@@ -0,0 +1,209 @@
+#include <compile_time_options.h>
+#include <description.h>
+#include <discretization.h>
+#include <initial_values.h>
+#include <offline_data.h>
+#include <parabolic_module.template.h>
+
+#include <deal.II/base/mpi.h>
+#include <deal.II/numerics/vector_tools.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <sstream>
+
+using namespace ryujin;
+using namespace dealii;
+
+/*
+ * Test the p-multigrid stage of the parabolic solver: For
+ * ORDER_FINITE_ELEMENT > 1 the multigrid preconditioners first coarsen
+ * in the polynomial degree down to Q1 and then descend the geometric
+ * hierarchy.
+ *
+ *  - The lumped mass matrices of all polynomial degrees of the
+ *    p-multigrid hierarchy have to sum up to the area of the (periodic)
+ *    unit square.
+ *
+ *  - A backward Euler step of the manufactured solution of
+ *    imex_manufactured.cc (a state at rest with internal energy
+ *    e_0 + A cos(2 pi x)) with multigrid preconditioners has to converge
+ *    without falling back to the diagonally preconditioned CG solver and
+ *    has to agree with the solution obtained with plain CG.
+ *
+ * For ORDER_FINITE_ELEMENT = 1 there are no polynomial levels and the
+ * test covers the geometric multigrid alone.
+ */
+
+constexpr int dim = DIM;
+using Number = NUMBER;
+using Description = NavierStokes::Description;
+
+static const std::string base_parameters = R"(
+subsection B - Equation
+  set gamma    = 1.4
+  set mu       = 0.01
+  set lambda   = 0
+  set kappa    = 0.1
+end
+subsection C - Discretization
+  set geometry        = rectangular domain
+  set mesh refinement = 3
+  subsection rectangular domain
+    set boundary condition bottom = periodic
+    set boundary condition left   = periodic
+    set boundary condition right  = periodic
+    set boundary condition top    = periodic
+    set position bottom left      = 0, 0
+    set position top right        = 1, 1
+    set subdivisions x            = 2
+    set subdivisions y            = 2
+  end
+end
+subsection G - ParabolicModule
+  set tolerance                     = 1e-13
+  set tolerance linfty norm         = false
+  set multigrid velocity - max iter = 50
+  set multigrid energy - max iter   = 50
+end
+)";
+
+
+int main(int argc, char *argv[])
+{
+  Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+  const MPI_Comm mpi_communicator = MPI_COMM_WORLD;
+
+  static_assert(dim == 2, "The test is set up for two spatial dimensions");
+
+  std::map<std::string, dealii::Timer> computing_timer;
+
+  Description::HyperbolicSystem hyperbolic_system("/B - Equation");
+  Description::ParabolicSystem parabolic_system("/B - Equation");
+  Discretization<dim> discretization(mpi_communicator, "/C - Discretization");
+  OfflineData<dim, Number> offline_data(
+      mpi_communicator, discretization, "/D - OfflineData");
+  InitialValues<Description, dim, Number> initial_values(
+      hyperbolic_system, offline_data, "/E - InitialValues");
+  ParabolicModule<Description, dim, Number> parabolic_module(
+      mpi_communicator,
+      computing_timer,
+      offline_data,
+      hyperbolic_system,
+      parabolic_system,
+      initial_values,
+      "/G - ParabolicModule");
+
+  using vector_type = ParabolicModule<Description, dim, Number>::vector_type;
+  using scalar_type = OfflineData<dim, Number>::scalar_type;
+
+  {
+    std::stringstream input(base_parameters);
+    ParameterAcceptor::initialize(input);
+  }
+
+  discretization.prepare();
+  offline_data.prepare(dim + 2);
+
+  const auto &scalar_partitioner = offline_data.scalar_partitioner();
+  const unsigned int n_owned = offline_data.n_locally_owned();
+
+  /* The nodal interpolant of the mode cos(2 pi x): */
+  scalar_type mode;
+  mode.reinit(scalar_partitioner);
+  VectorTools::interpolate(offline_data.dof_handler(),
+                           ScalarFunctionFromFunctionObject<dim, Number>(
+                               [](const Point<dim> &point) {
+                                 return std::cos(2. * M_PI * point[0]);
+                               }),
+                           mode);
+
+  constexpr Number e_0 = 1.;
+  constexpr Number amplitude = 0.1;
+
+  vector_type old_U;
+  old_U.reinit(offline_data.vector_partitioner());
+  for (unsigned int i = 0; i < n_owned; ++i) {
+    Tensor<1, dim + 2, Number> U_i;
+    U_i[0] = Number(1.);
+    U_i[dim + 1] = e_0 + amplitude * mode.local_element(i);
+    old_U.write_tensor(U_i, i);
+  }
+  old_U.update_ghost_values();
+
+  /*
+   * The number of internal energy iterations of the last step, recovered
+   * from the status line "[ v GMG vel -- e GMG int ]" of the solver
+   * statistics:
+   */
+  const auto iterations = [&]() {
+    std::stringstream statistics;
+    parabolic_module.print_solver_statistics(statistics);
+    std::string bracket, velocity, gmg, vel, dashes, energy;
+    statistics >> bracket >> velocity >> gmg >> vel >> dashes >> energy;
+    return static_cast<unsigned int>(std::round(10. * std::stod(energy)));
+  };
+
+  /* Lumped mass matrices of the polynomial levels: */
+
+  constexpr auto order = Discretization<dim>::order_finite_element;
+
+  bool masses_sum_to_area = true;
+  if constexpr (order > 1)
+    for (unsigned int degree = 1; degree <= order; ++degree) {
+      const auto &lumped_mass_matrix =
+          offline_data.p_level_lumped_mass_matrix()[degree];
+      if (!(std::abs(lumped_mass_matrix.l1_norm() - 1.) < 1.e-5))
+        masses_sum_to_area = false;
+    }
+
+  std::cout << "p-level lumped mass matrices sum to the area: "
+            << (masses_sum_to_area ? "OK" : "FAILED") << std::endl;
+
+  /* A backward Euler step with and without multigrid: */
+
+  constexpr Number tau = 0.25;
+  vector_type cg_U, gmg_U;
+  cg_U.reinit(offline_data.vector_partitioner());
+  gmg_U.reinit(offline_data.vector_partitioner());
+
+  unsigned int n_iterations = 0;
+  for (const bool multigrid : {false, true}) {
+    std::stringstream input;
+    input << base_parameters << "subsection G - ParabolicModule\n"
+          << "  set multigrid velocity = " << (multigrid ? "true" : "false")
+          << "\n  set multigrid energy   = " << (multigrid ? "true" : "false")
+          << "\nend\n";
+    ParameterAcceptor::initialize(input);
+
+    parabolic_module.prepare();
+    parabolic_module.reset_statistics();
+
+    auto &new_U = multigrid ? gmg_U : cg_U;
+    parabolic_module.step<0>(old_U, 0., {}, {}, new_U, tau, 0);
+    new_U.update_ghost_values();
+
+    if (multigrid)
+      n_iterations = iterations();
+  }
+
+  const auto view = hyperbolic_system.view<dim, Number>();
+  double difference = 0.;
+  for (unsigned int i = 0; i < n_owned; ++i) {
+    const auto cg_U_i = cg_U.get_tensor(i);
+    const auto gmg_U_i = gmg_U.get_tensor(i);
+    const auto e_i = view.internal_energy(cg_U_i) / view.density(cg_U_i);
+    const auto gmg_e_i =
+        view.internal_energy(gmg_U_i) / view.density(gmg_U_i);
+    difference = std::max(difference, double(std::abs(e_i - gmg_e_i)));
+  }
+  difference = Utilities::MPI::max(difference, mpi_communicator);
+
+  std::cout << "multigrid converged: "
+            << (n_iterations > 0 && n_iterations < 50 ? "OK" : "FAILED")
+            << std::endl;
+  std::cout << "multigrid agrees with CG: "
+            << (difference < 1.e-8 * amplitude ? "OK" : "FAILED")
+            << std::endl;
+}